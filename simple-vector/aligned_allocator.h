@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "array_ptr.h"
+#include "malloc_allocator.h"
+
+
+//    x86   ARM.         128
+inline constexpr size_t kCacheLineSize = 64;
+
+// ,     Alignment  (64 -     AVX-512).
+//       SimpleVector: , , Reserve, ShrinkToFit.
+// SimpleVector<Type, AlignedAllocator<Type, 64>>::AlignedData()    ,
+//        
+template <typename Type, size_t Alignment = kCacheLineSize>
+class AlignedAllocator {
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+    using value_type = Type;
+
+    //    
+    static constexpr size_t kAlignment = Alignment > alignof(Type) ? Alignment : alignof(Type);
+
+    template <typename Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename Other>
+    AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        void* ptr = allocator_detail::AlignedMalloc(kAlignment, allocator_detail::AlignedBytes<Type>(n, kAlignment));
+        if (ptr == nullptr) throw std::bad_alloc();
+        return static_cast<Type*>(ptr);
+    }
+
+    Type* allocate_zeroed(size_t n) {
+        Type* ptr = allocate(n);
+        std::memset(static_cast<void*>(ptr), 0, n * sizeof(Type));
+        return ptr;
+    }
+
+    void deallocate(Type* ptr, size_t) noexcept {
+        allocator_detail::AlignedFree(ptr);
+    }
+
+    //   ,   .
+    //   realloc:   glibc   mremap    .
+    //  realloc   ,      .
+    //  Windows  _aligned_malloc   _aligned_realloc,    
+    Type* reallocate(Type* ptr, [[maybe_unused]] size_t old_n, size_t new_n) {
+        if (ptr == nullptr) {
+            return allocate(new_n);
+        }
+        const size_t bytes = allocator_detail::AlignedBytes<Type>(new_n, kAlignment);
+#if defined(_WIN32)
+        void* moved = _aligned_realloc(ptr, bytes, kAlignment);
+        if (moved == nullptr) throw std::bad_alloc();
+        return static_cast<Type*>(moved);
+#else
+        void* moved = std::realloc(static_cast<void*>(ptr), bytes);
+        if (moved == nullptr) throw std::bad_alloc();
+        if (reinterpret_cast<uintptr_t>(moved) % kAlignment == 0) {
+            return static_cast<Type*>(moved);
+        }
+        void* fresh = allocator_detail::AlignedMalloc(kAlignment, bytes);
+        if (fresh == nullptr) {
+            std::free(moved);
+            throw std::bad_alloc();
+        }
+        std::memcpy(fresh, moved, (old_n < new_n ? old_n : new_n) * sizeof(Type));
+        std::free(moved);
+        return static_cast<Type*>(fresh);
+#endif
+    }
+};
+
+template <typename Lhs, typename Rhs, size_t Alignment>
+bool operator==(const AlignedAllocator<Lhs, Alignment>&, const AlignedAllocator<Rhs, Alignment>&) noexcept {
+    return true;
+}
+
+template <typename Lhs, typename Rhs, size_t Alignment>
+bool operator!=(const AlignedAllocator<Lhs, Alignment>&, const AlignedAllocator<Rhs, Alignment>&) noexcept {
+    return false;
+}
+
+// ,    .     SimpleVector<CacheLinePadded<long>>
+//         (false sharing).   
+//   MallocAllocator,  AlignedAllocator
+template <typename Type, size_t Alignment = kCacheLineSize>
+struct alignas(Alignment) CacheLinePadded {
+    Type value;
+
+    CacheLinePadded() = default;
+
+    template <typename Arg, typename... Rest, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<Arg>, CacheLinePadded> && std::is_constructible_v<Type, Arg&&, Rest&&...>>>
+    CacheLinePadded(Arg&& arg, Rest&&... rest) : value(std::forward<Arg>(arg), std::forward<Rest>(rest)...) {
+    }
+
+    Type& Get() noexcept {
+        return value;
+    }
+
+    const Type& Get() const noexcept {
+        return value;
+    }
+};
+
+template <typename Type, size_t Alignment>
+struct IsTriviallyRelocatable<CacheLinePadded<Type, Alignment>> : IsTriviallyRelocatable<Type> {
+};
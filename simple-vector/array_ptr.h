@@ -1,27 +1,201 @@
 #pragma once
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#if __has_include(<version>)
+#include <version>
+#endif
+#include "malloc_allocator.h"
 
+//  C++20         (constexpr-).
+// ,   ,  SIMPLE_VECTOR_CONSTEXPR;  C++17  
+#if defined(__cpp_lib_constexpr_dynamic_alloc)
+#define SIMPLE_VECTOR_HAS_CONSTEXPR 1
+#define SIMPLE_VECTOR_CONSTEXPR constexpr
+#else
+#define SIMPLE_VECTOR_HAS_CONSTEXPR 0
+#define SIMPLE_VECTOR_CONSTEXPR
+#endif
+
+//     :   std::allocator,   memcpy/realloc 
+constexpr bool IsConstantEvaluated() noexcept {
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+//             .
+//      ;     
+template <typename Type>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<Type> {
+};
+
+//   reallocate(ptr, old_n, new_n)
+template <typename Allocator, typename = void>
+struct AllocatorHasReallocate : std::false_type {
+};
+
+template <typename Allocator>
+struct AllocatorHasReallocate<Allocator, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+    std::declval<typename Allocator::value_type*>(), size_t(), size_t()))>> : std::true_type {
+};
+
+//    (Type())      ,
+//       
+template <typename Type>
+struct IsZeroInitializable : std::bool_constant<std::is_scalar_v<Type> && !std::is_member_pointer_v<Type>> {
+};
+
+//   allocate_zeroed(n),    (calloc,  mmap)
+template <typename Allocator, typename = void>
+struct AllocatorHasAllocateZeroed : std::false_type {
+};
+
+template <typename Allocator>
+struct AllocatorHasAllocateZeroed<Allocator, std::void_t<decltype(std::declval<Allocator&>().allocate_zeroed(size_t()))>>
+    : std::true_type {
+};
+
+//    : Allocator::kAlignment,    ,  alignof
+template <typename Allocator, typename = void>
+struct AllocatorAlignment : std::integral_constant<size_t, alignof(typename Allocator::value_type)> {
+};
+
+template <typename Allocator>
+struct AllocatorAlignment<Allocator, std::void_t<decltype(Allocator::kAlignment)>>
+    : std::integral_constant<size_t, Allocator::kAlignment> {
+};
+
+//  ptr,  ,    Alignment.
+//   std::assume_aligned  __builtin_assume_aligned    
+template <size_t Alignment, typename Type>
+Type* AssumeAligned(Type* ptr) noexcept {
+#if defined(__cpp_lib_assume_aligned)
+    return std::assume_aligned<Alignment>(ptr);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<Type*>(__builtin_assume_aligned(ptr, Alignment));
+#else
+    return ptr;
+#endif
+}
+
+namespace array_detail {
+
+//     .  C++20     
+template <typename Type, typename... Args>
+SIMPLE_VECTOR_CONSTEXPR Type* ConstructAt(Type* place, Args&&... args) {
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    return std::construct_at(place, std::forward<Args>(args)...);
+#else
+    return new (place) Type(std::forward<Args>(args)...);
+#endif
+}
+
+//  std::uninitialized_*,     .
+//            
+template <typename InputIt, typename Type>
+SIMPLE_VECTOR_CONSTEXPR Type* UninitializedCopyN(InputIt first, size_t count, Type* dest) {
+    if (!IsConstantEvaluated()) {
+        return std::uninitialized_copy_n(first, count, dest);
+    }
+    for (size_t i = 0; i < count; ++i, ++first) {
+        ConstructAt(dest + i, *first);
+    }
+    return dest + count;
+}
+
+template <typename InputIt, typename Type>
+SIMPLE_VECTOR_CONSTEXPR Type* UninitializedCopy(InputIt first, InputIt last, Type* dest) {
+    if (!IsConstantEvaluated()) {
+        return std::uninitialized_copy(first, last, dest);
+    }
+    for (; first != last; ++first, ++dest) {
+        ConstructAt(dest, *first);
+    }
+    return dest;
+}
+
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR Type* UninitializedMove(Type* first, Type* last, Type* dest) {
+    if (!IsConstantEvaluated()) {
+        return std::uninitialized_move(first, last, dest);
+    }
+    for (; first != last; ++first, ++dest) {
+        ConstructAt(dest, std::move(*first));
+    }
+    return dest;
+}
+
+template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR void UninitializedFill(Type* first, Type* last, const Type& value) {
+    if (!IsConstantEvaluated()) {
+        std::uninitialized_fill(first, last, value);
+        return;
+    }
+    for (; first != last; ++first) {
+        ConstructAt(first, value);
+    }
+}
 
 template <typename Type>
+SIMPLE_VECTOR_CONSTEXPR void UninitializedValueConstruct(Type* first, Type* last) {
+    if (!IsConstantEvaluated()) {
+        std::uninitialized_value_construct(first, last);
+        return;
+    }
+    for (; first != last; ++first) {
+        ConstructAt(first);
+    }
+}
+
+} // namespace array_detail
+
+template <typename Type, typename Allocator = MallocAllocator<Type>>
 class ArrayPtr {
+    using AllocTraits = std::allocator_traits<Allocator>;
 public:
     //  ArrayPtr  
-    ArrayPtr() = default;
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr() = default;
+
+    //  ArrayPtr     
+    SIMPLE_VECTOR_CONSTEXPR explicit ArrayPtr(const Allocator& alloc) noexcept : alloc_(alloc) {
+    }
 
-    //      size   Type.
-    //  size == 0,  raw_ptr_    nullptr
-    explicit ArrayPtr(size_t size) {
+    //      size   Type.
+    //   :       .
+    //  size == 0,  raw_ptr_    nullptr.
+    //      std::allocator:   malloc  
+    SIMPLE_VECTOR_CONSTEXPR explicit ArrayPtr(size_t size, const Allocator& alloc = Allocator()) : alloc_(alloc) {
         if (size > 0) {
-            Type* array = new Type[size];
-            raw_ptr_ = array;
+            raw_ptr_ = IsConstantEvaluated() ? std::allocator<Type>().allocate(size) : AllocTraits::allocate(alloc_, size);
+            size_ = size;
+        }
+    }
+
+    //    size ,   .
+    //       ,    
+    static ArrayPtr AllocateZeroed(size_t size, const Allocator& alloc = Allocator()) {
+        ArrayPtr result(alloc);
+        if (size == 0) return result;
+        if constexpr (AllocatorHasAllocateZeroed<Allocator>::value) {
+            result.raw_ptr_ = result.alloc_.allocate_zeroed(size);
         }
-        else ArrayPtr();
+        else {
+            result.raw_ptr_ = AllocTraits::allocate(result.alloc_, size);
+            std::memset(static_cast<void*>(result.raw_ptr_), 0, size * sizeof(Type));
+        }
+        result.size_ = size;
+        return result;
     }
 
-    //    ,       nullptr
-    explicit ArrayPtr(Type* raw_ptr)  noexcept : raw_ptr_(raw_ptr) {
-        raw_ptr_ = raw_ptr;
+    //      size ,   alloc,  nullptr
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr(Type* raw_ptr, size_t size, const Allocator& alloc = Allocator()) noexcept
+        : raw_ptr_(raw_ptr), size_(raw_ptr ? size : 0), alloc_(alloc) {
     }
 
     //  
@@ -29,61 +203,108 @@ public:
     //  
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
-    ArrayPtr(ArrayPtr&& rhs) {
-        swap(rhs.raw_ptr_);
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr(ArrayPtr&& rhs) noexcept : alloc_(rhs.alloc_) {
+        std::swap(raw_ptr_, rhs.raw_ptr_);
+        std::swap(size_, rhs.size_);
     };
 
-    ArrayPtr& operator=(ArrayPtr&& rhs) {
+    SIMPLE_VECTOR_CONSTEXPR ArrayPtr& operator=(ArrayPtr&& rhs) noexcept {
         if (this != &rhs) {
-            swap(rhs.raw_ptr_);
+            swap(rhs);
         }
         return *this;
     };
 
-    ~ArrayPtr() {
-        delete[] raw_ptr_;
+    //  .    .
+    // ,    ,    
+    SIMPLE_VECTOR_CONSTEXPR ~ArrayPtr() {
+        if (raw_ptr_ == nullptr) {
+            return;
+        }
+        if (IsConstantEvaluated()) {
+            std::allocator<Type>().deallocate(raw_ptr_, size_);
+        }
+        else {
+            AllocTraits::deallocate(alloc_, raw_ptr_, size_);
+        }
     }
 
-    
+
     //     ,    
     //        
-    [[nodiscard]] Type* Release() noexcept {
+    [[nodiscard]] SIMPLE_VECTOR_CONSTEXPR Type* Release() noexcept {
         Type* raw = raw_ptr_;
         raw_ptr_ = nullptr;
+        size_ = 0;
         return raw;
     }
 
     //        index
-    Type& operator[](size_t index) noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type& operator[](size_t index) noexcept {
         return raw_ptr_[index];
     }
 
     //         index
-    const Type& operator[](size_t index) const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR const Type& operator[](size_t index) const noexcept {
         const Type& link = raw_ptr_[index];
         return link;
     }
 
     //  true,   ,  false   
-    explicit operator bool() const {
+    SIMPLE_VECTOR_CONSTEXPR explicit operator bool() const {
         return (raw_ptr_ != nullptr);
     }
 
     //    ,    
-    Type* Get() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type* Get() const noexcept {
         return raw_ptr_;
     }
 
-    //        other
-    void swap(ArrayPtr& other) noexcept {
-        Type* tmp = this->raw_ptr_;
-        this->raw_ptr_ = other.raw_ptr_;
-        other.raw_ptr_ = tmp;
+    //     new_size ,   used .
+    //   ,       
+    void Reallocate(size_t new_size, size_t used) {
+        static_assert(IsTriviallyRelocatable<Type>::value);
+        assert(used <= size_ && used <= new_size);
+        if (new_size == 0) {
+            ArrayPtr empty(alloc_);
+            swap(empty);
+            return;
+        }
+        if constexpr (AllocatorHasReallocate<Allocator>::value) {
+            raw_ptr_ = alloc_.reallocate(raw_ptr_, size_, new_size);
+            size_ = new_size;
+        }
+        else {
+            ArrayPtr fresh(new_size, alloc_);
+            if (used > 0) {
+                std::memcpy(static_cast<void*>(fresh.raw_ptr_), raw_ptr_, used * sizeof(Type));
+            }
+            swap(fresh);
+        }
+    }
+
+    //   ,    
+    SIMPLE_VECTOR_CONSTEXPR size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //  ,     
+    SIMPLE_VECTOR_CONSTEXPR const Allocator& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    //          other
+    SIMPLE_VECTOR_CONSTEXPR void swap(ArrayPtr& other) noexcept {
+        std::swap(raw_ptr_, other.raw_ptr_);
+        std::swap(size_, other.size_);
+        std::swap(alloc_, other.alloc_);
     }
 
 private:
     Type* raw_ptr_ = nullptr;
-   
+    size_t size_ = 0;
+    Allocator alloc_;
+
 };
 
 
@@ -0,0 +1,57 @@
+// Добавление из многих потоков: ConcurrentSimpleVector против SimpleVector под мьютексом.
+// Запуск: concurrent_push_bench [элементов на поток], по умолчанию 1000000
+#include "../concurrent_simple_vector.h"
+#include "../simple_vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+template <typename Push>
+double MeasureMs(size_t threads, size_t per_thread, Push push) {
+    auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (size_t i = 0; i < per_thread; ++i) {
+                push(static_cast<uint64_t>(t * per_thread + i));
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    const size_t per_thread = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t max_threads = max(2u, thread::hardware_concurrency());
+
+    cout << "elements per thread: " << per_thread << endl;
+    cout << setw(8) << "threads" << setw(14) << "mutex, ms" << setw(16) << "concurrent, ms" << setw(10) << "speedup" << endl;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        SimpleVector<uint64_t> locked;
+        mutex guard;
+        double with_mutex = MeasureMs(threads, per_thread, [&](uint64_t value) {
+            lock_guard lock(guard);
+            locked.PushBack(value);
+        });
+
+        ConcurrentSimpleVector<uint64_t> concurrent;
+        double lock_free = MeasureMs(threads, per_thread, [&](uint64_t value) {
+            concurrent.PushBack(value);
+        });
+
+        cout << setw(8) << threads << setw(14) << fixed << setprecision(1) << with_mutex << setw(16) << lock_free
+             << setw(10) << setprecision(2) << with_mutex / lock_free << endl;
+    }
+    return 0;
+}
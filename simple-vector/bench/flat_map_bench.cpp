@@ -0,0 +1,79 @@
+// Поиск по ключу: std::map (узлы в куче) против FlatMap (ключи подряд, двоичный поиск без ветвлений),
+// а также построение из неотсортированных пар: одна сортировка против n вставок.
+// Запуск: flat_map_bench [ключей], по умолчанию 1000000
+#include "../simple_vector.h"
+#include "../flat_map.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <utility>
+
+using namespace std;
+
+template <typename Function>
+double MeasureMs(int repeats, Function function) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        function();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / repeats;
+}
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const int repeats = 5;
+
+    mt19937_64 generator(7);
+    SimpleVector<pair<uint64_t, uint64_t>> pairs;
+    SimpleVector<uint64_t> probes;
+    pairs.Reserve(count);
+    probes.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t key = generator();
+        pairs.PushBack({key, i});
+        probes.PushBack(i % 2 ? key : generator());
+    }
+
+    map<uint64_t, uint64_t> tree;
+    FlatMap<uint64_t, uint64_t> flat;
+    double tree_build_ms = MeasureMs(1, [&] {
+        for (const auto& [key, value] : pairs) {
+            tree.emplace(key, value);
+        }
+    });
+    double flat_build_ms = MeasureMs(1, [&] {
+        flat = FlatMap<uint64_t, uint64_t>(pairs.begin(), pairs.end());
+    });
+
+    volatile uint64_t sink = 0;
+    double tree_find_ms = MeasureMs(repeats, [&] {
+        uint64_t sum = 0;
+        for (uint64_t key : probes) {
+            auto it = tree.find(key);
+            sum += it != tree.end() ? it->second : 0;
+        }
+        sink = sum;
+    });
+    double flat_find_ms = MeasureMs(repeats, [&] {
+        uint64_t sum = 0;
+        for (uint64_t key : probes) {
+            auto it = flat.Find(key);
+            sum += it != flat.end() ? it.GetValue() : 0;
+        }
+        sink = sum;
+    });
+
+    cout << "keys: " << count << ", lookups: " << count << " (half hit)" << endl;
+    cout << fixed << setprecision(2);
+    cout << setw(22) << "std::map build" << setw(10) << tree_build_ms << " ms" << endl;
+    cout << setw(22) << "FlatMap build" << setw(10) << flat_build_ms << " ms" << endl;
+    cout << setw(22) << "std::map find" << setw(10) << tree_find_ms << " ms" << endl;
+    cout << setw(22) << "FlatMap find" << setw(10) << flat_find_ms << " ms" << endl;
+    cout << setw(22) << "find speedup" << setw(10) << tree_find_ms / flat_find_ms << endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+// Масштабирование параллельного заполнения и копирования SimpleVector.
+// Запуск: parallel_fill_bench [мегабайт], по умолчанию 1024
+#include "../simple_vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+using namespace std;
+
+template <typename Function>
+double MeasureMs(Function function) {
+    auto start = chrono::steady_clock::now();
+    function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    const size_t megabytes = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1024;
+    const size_t count = megabytes * 1024 * 1024 / sizeof(uint64_t);
+    const size_t max_threads = max(1u, thread::hardware_concurrency());
+
+    cout << "elements: " << count << " (" << megabytes << " MB)" << endl;
+    cout << setw(8) << "threads" << setw(12) << "fill, ms" << setw(12) << "copy, ms" << setw(10) << "speedup" << endl;
+    double single_thread = 0;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const ParallelPolicy policy{threads, 1024 * 1024};
+        double fill = 0;
+        double copy = 0;
+        {
+            unique_ptr<SimpleVector<uint64_t>> source;
+            fill = MeasureMs([&] { source = make_unique<SimpleVector<uint64_t>>(count, 42, policy); });
+            copy = MeasureMs([&] { SimpleVector<uint64_t> copied(*source, policy); });
+        }
+        if (threads == 1) {
+            single_thread = fill + copy;
+        }
+        cout << setw(8) << threads << setw(12) << fixed << setprecision(1) << fill << setw(12) << copy
+             << setw(10) << setprecision(2) << single_thread / (fill + copy) << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Проход по двум полям из девяти: SimpleVector<Particle> (массив структур) против колонок SoaVector.
+// Запуск: soa_scan_bench [частиц], по умолчанию 4000000
+#include "../simple_vector.h"
+#include "../soa_vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+struct Particle {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass;
+    int32_t id;
+    int32_t flags;
+};
+
+template <typename Function>
+double MeasureMs(int repeats, Function function) {
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        function();
+    }
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / repeats;
+}
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+    const int repeats = 20;
+
+    SimpleVector<Particle> aos;
+    SoaVector<float, float, float, float, float, float, float, int32_t, int32_t> soa;
+    aos.Reserve(count);
+    soa.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        float f = static_cast<float>(i % 1000);
+        aos.PushBack({f, f, f, f * 0.5f, f, f, 1.f, static_cast<int32_t>(i), 0});
+        soa.PushBack(f, f, f, f * 0.5f, f, f, 1.f, static_cast<int32_t>(i), 0);
+    }
+
+    //x += vx по всем частицам
+    volatile float sink = 0;
+    double aos_ms = MeasureMs(repeats, [&] {
+        for (Particle& particle : aos) {
+            particle.x += particle.vx;
+        }
+        sink = aos[count / 2].x;
+    });
+    double soa_ms = MeasureMs(repeats, [&] {
+        auto x = soa.Column<0>();
+        auto vx = soa.Column<3>();
+        for (size_t i = 0; i < x.GetSize(); ++i) {
+            x[i] += vx[i];
+        }
+        sink = x[count / 2];
+    });
+
+    cout << "particles: " << count << ", fields touched: 2 of 9" << endl;
+    cout << fixed << setprecision(2);
+    cout << setw(22) << "SimpleVector<Particle>" << setw(10) << aos_ms << " ms" << endl;
+    cout << setw(22) << "SoaVector columns" << setw(10) << soa_ms << " ms" << endl;
+    cout << setw(22) << "speedup" << setw(10) << aos_ms / soa_ms << endl;
+    return 0;
+}
@@ -0,0 +1,244 @@
+// Сравнение SimpleVector и std::vector на основных операциях.
+// Результат печатается в JSON, чтобы сравнивать версии между собой:
+//     vector_bench [--size N] [--repeats R] [--output file.json]
+// Для каждой операции берётся лучшее время из R повторов
+#include "../simple_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+template <typename T>
+void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+// Обёртки приводят оба вектора к одному интерфейсу
+template <typename T>
+void Push(SimpleVector<T>& vector, const T& value) {
+    vector.PushBack(value);
+}
+template <typename T>
+void Push(std::vector<T>& vector, const T& value) {
+    vector.push_back(value);
+}
+
+template <typename T>
+void InsertAt(SimpleVector<T>& vector, size_t index, const T& value) {
+    vector.Insert(vector.begin() + index, value);
+}
+template <typename T>
+void InsertAt(std::vector<T>& vector, size_t index, const T& value) {
+    vector.insert(vector.begin() + index, value);
+}
+
+template <typename T>
+void EraseAt(SimpleVector<T>& vector, size_t index) {
+    vector.Erase(vector.begin() + index);
+}
+template <typename T>
+void EraseAt(std::vector<T>& vector, size_t index) {
+    vector.erase(vector.begin() + index);
+}
+
+template <typename T>
+void ReserveFor(SimpleVector<T>& vector, size_t capacity) {
+    vector.Reserve(capacity);
+}
+template <typename T>
+void ReserveFor(std::vector<T>& vector, size_t capacity) {
+    vector.reserve(capacity);
+}
+
+template <typename T>
+void ResizeTo(SimpleVector<T>& vector, size_t size) {
+    vector.Resize(size);
+}
+template <typename T>
+void ResizeTo(std::vector<T>& vector, size_t size) {
+    vector.resize(size);
+}
+
+template <typename T>
+size_t SizeOf(const SimpleVector<T>& vector) {
+    return vector.GetSize();
+}
+template <typename T>
+size_t SizeOf(const std::vector<T>& vector) {
+    return vector.size();
+}
+
+struct Result {
+    string name;
+    size_t size;
+    double simple_vector_ns;
+    double std_vector_ns;
+};
+
+// Лучшее время одного прогона: prepare не замеряется, run замеряется
+template <typename Vector, typename Prepare, typename Run>
+double BestNs(int repeats, Prepare prepare, Run run) {
+    //Первый прогон не замеряется: он прогревает кэши и кучу
+    double best = numeric_limits<double>::max();
+    for (int i = -1; i < repeats; ++i) {
+        Vector vector = prepare();
+        auto start = chrono::steady_clock::now();
+        run(vector);
+        double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        DoNotOptimize(vector);
+        if (i >= 0) {
+            best = min(best, elapsed);
+        }
+    }
+    return best;
+}
+
+class Suite {
+public:
+    Suite(size_t size, int repeats) : size_(size), repeats_(repeats) {
+    }
+
+    // Запускает одну и ту же операцию для обоих векторов элементов T
+    template <typename T, typename Prepare, typename Run>
+    void Compare(const string& name, size_t size, Prepare prepare, Run run) {
+        double simple = BestNs<SimpleVector<T>>(repeats_, [&] { return prepare(SimpleVector<T>()); }, run);
+        double standard = BestNs<std::vector<T>>(repeats_, [&] { return prepare(std::vector<T>()); }, run);
+        results_.push_back({name, size, simple, standard});
+    }
+
+    template <typename T>
+    void RunAll(const string& type_name, const function<T(size_t)>& make) {
+        const size_t n = size_;
+        const size_t edits = max<size_t>(1, n / 100);
+        auto empty = [](auto vector) { return vector; };
+        auto filled = [&](auto vector) {
+            for (size_t i = 0; i < n; ++i) {
+                Push(vector, make(i));
+            }
+            return vector;
+        };
+
+        Compare<T>("PushBack/" + type_name, n, empty, [&](auto& vector) {
+            for (size_t i = 0; i < n; ++i) {
+                Push(vector, make(i));
+            }
+        });
+        Compare<T>("PushBackReserved/" + type_name, n, empty, [&](auto& vector) {
+            ReserveFor(vector, n);
+            for (size_t i = 0; i < n; ++i) {
+                Push(vector, make(i));
+            }
+        });
+        const pair<const char*, int> positions[] = {{"Front", 0}, {"Middle", 1}, {"Back", 2}};
+        for (auto [where, kind] : positions) {
+            auto index = [kind = kind](size_t size) { return kind == 0 ? 0 : kind == 1 ? size / 2 : size; };
+            Compare<T>(string("Insert") + where + "/" + type_name, edits, filled, [&](auto& vector) {
+                for (size_t i = 0; i < edits; ++i) {
+                    InsertAt(vector, index(SizeOf(vector)), make(i));
+                }
+            });
+            Compare<T>(string("Erase") + where + "/" + type_name, edits, filled, [&](auto& vector) {
+                for (size_t i = 0; i < edits; ++i) {
+                    size_t size = SizeOf(vector);
+                    EraseAt(vector, min(index(size), size - 1));
+                }
+            });
+        }
+        Compare<T>("Reserve/" + type_name, n, filled, [&](auto& vector) {
+            ReserveFor(vector, 2 * n);
+        });
+        Compare<T>("Resize/" + type_name, n, empty, [&](auto& vector) {
+            ResizeTo(vector, n);
+        });
+        Compare<T>("Copy/" + type_name, n, filled, [&](auto& vector) {
+            auto copy = vector;
+            DoNotOptimize(copy);
+        });
+        Compare<T>("Move/" + type_name, n, filled, [&](auto& vector) {
+            auto moved = std::move(vector);
+            DoNotOptimize(moved);
+            vector = std::move(moved);
+        });
+        Compare<T>("Iterate/" + type_name, n, filled, [&](auto& vector) {
+            size_t checksum = 0;
+            for (const T& item : vector) {
+                checksum += Checksum(item);
+            }
+            DoNotOptimize(checksum);
+        });
+    }
+
+    void PrintJson(ostream& out) const {
+        out << "{\n  \"size\": " << size_ << ",\n  \"repeats\": " << repeats_ << ",\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const Result& result = results_[i];
+            out << "    {\"name\": \"" << result.name << "\", \"operations\": " << result.size
+                << ", \"simple_vector_ns\": " << result.simple_vector_ns
+                << ", \"std_vector_ns\": " << result.std_vector_ns
+                << ", \"ratio\": " << result.simple_vector_ns / result.std_vector_ns << "}"
+                << (i + 1 < results_.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+private:
+    size_t size_;
+    int repeats_;
+    std::vector<Result> results_;
+
+    static size_t Checksum(int value) {
+        return static_cast<size_t>(value);
+    }
+    static size_t Checksum(const string& value) {
+        return value.size();
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t size = 100000;
+    int repeats = 5;
+    string output;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--size") == 0) {
+            size = strtoull(argv[i + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[i], "--repeats") == 0) {
+            repeats = atoi(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "--output") == 0) {
+            output = argv[i + 1];
+        }
+        else {
+            cerr << "unknown option " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    Suite suite(size, max(1, repeats));
+    suite.RunAll<int>("int", [](size_t i) { return static_cast<int>(i); });
+    suite.RunAll<string>("string", [](size_t i) { return "heavy element number " + to_string(i); });
+
+    if (output.empty()) {
+        suite.PrintJson(cout);
+    }
+    else {
+        ofstream file(output);
+        suite.PrintJson(file);
+    }
+    return 0;
+}
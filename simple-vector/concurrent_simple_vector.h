@@ -0,0 +1,254 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "malloc_allocator.h"
+
+
+//       .
+//    ,     :  k
+//  FirstSegment << k .     ,
+//    ,       .
+// PushBack/EmplaceBack    ,   
+//         .
+//  k + 1  ,      k,  
+//      .     ,   ,
+//  .   :  ,   .
+//     ,  IsReady(index)  true.
+//     ,     
+template <typename Type, size_t FirstSegment = 64, typename Allocator = MallocAllocator<Type>>
+class ConcurrentSimpleVector {
+    static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0, "FirstSegment must be a power of two");
+
+    struct Slot {
+        alignas(Type) unsigned char storage[sizeof(Type)];
+        std::atomic<bool> ready{false};
+
+        Type* Get() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+public:
+    ConcurrentSimpleVector() noexcept = default;
+    explicit ConcurrentSimpleVector(const Allocator& alloc) noexcept : alloc_(alloc) {
+    }
+
+    //      ,     ,  
+    ConcurrentSimpleVector(const ConcurrentSimpleVector&) = delete;
+    ConcurrentSimpleVector& operator=(const ConcurrentSimpleVector&) = delete;
+
+    //   .  ,   ,    
+    ~ConcurrentSimpleVector();
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //        .  ,    .
+    //      Type  ,     
+    template <typename... Args>
+    size_t EmplaceBack(Args&&... args);
+
+    size_t PushBack(const Type& item) {
+        return EmplaceBack(item);
+    }
+
+    size_t PushBack(Type&& item) {
+        return EmplaceBack(std::move(item));
+    }
+
+    //     capacity ,     
+    void Reserve(size_t capacity);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //   .      
+    size_t GetSize() const noexcept {
+        return claimed_.load(std::memory_order_acquire);
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //  index     
+    bool IsReady(size_t index) const noexcept;
+
+    //     .    : IsReady(index) == true
+    //      
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return *SlotAt(index).Get();
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return *SlotAt(index).Get();
+    }
+
+    //   std::out_of_range,   index  
+    Type& At(size_t index) {
+        if (!IsReady(index)) throw std::out_of_range("element is not ready");
+        return *SlotAt(index).Get();
+    }
+
+    const Type& At(size_t index) const {
+        if (!IsReady(index)) throw std::out_of_range("element is not ready");
+        return *SlotAt(index).Get();
+    }
+
+    //  function(index, element)       
+    template <typename Function>
+    void ForEachReady(Function function) const;
+
+private:
+    static constexpr size_t kFirstShift = __builtin_ctzll(FirstSegment);
+    static constexpr size_t kMaxSegments = sizeof(size_t) * 8 - kFirstShift;
+
+    std::atomic<Slot*> segments_[kMaxSegments] = {};
+    std::atomic<size_t> claimed_{0};
+    SlotAllocator alloc_;
+
+    static size_t SegmentOf(size_t index) noexcept {
+        size_t shifted = index + FirstSegment;
+        return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(shifted) - kFirstShift;
+    }
+
+    static size_t SegmentSize(size_t segment) noexcept {
+        return FirstSegment << segment;
+    }
+
+    //   
+    static size_t SegmentStart(size_t segment) noexcept {
+        return SegmentSize(segment) - FirstSegment;
+    }
+
+    //   :     ,    
+    Slot& SlotAt(size_t index) const noexcept {
+        size_t segment = SegmentOf(index);
+        return segments_[segment].load(std::memory_order_acquire)[index - SegmentStart(segment)];
+    }
+
+    // ,       
+    Slot* EnsureSegment(size_t segment);
+
+    //  .   :   ,   
+    void PrepareSegment(size_t segment) noexcept;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+ConcurrentSimpleVector<Type, FirstSegment, Allocator>::~ConcurrentSimpleVector() {
+    for (size_t segment = 0; segment < kMaxSegments; ++segment) {
+        Slot* slots = segments_[segment].load(std::memory_order_relaxed);
+        if (slots == nullptr) {
+            continue;
+        }
+        for (size_t i = 0; i < SegmentSize(segment); ++i) {
+            if (slots[i].ready.load(std::memory_order_relaxed)) {
+                std::destroy_at(slots[i].Get());
+            }
+        }
+        std::destroy_n(slots, SegmentSize(segment));
+        std::allocator_traits<SlotAllocator>::deallocate(alloc_, slots, SegmentSize(segment));
+    }
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+template <typename... Args>
+size_t ConcurrentSimpleVector<Type, FirstSegment, Allocator>::EmplaceBack(Args&&... args) {
+    size_t index = claimed_.fetch_add(1, std::memory_order_relaxed);
+    size_t segment = SegmentOf(index);
+    Slot& slot = EnsureSegment(segment)[index - SegmentStart(segment)];
+    if (index == SegmentStart(segment)) {
+        PrepareSegment(segment + 1);
+    }
+    new (slot.storage) Type(std::forward<Args>(args)...);
+    slot.ready.store(true, std::memory_order_release);
+    return index;
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+void ConcurrentSimpleVector<Type, FirstSegment, Allocator>::Reserve(size_t capacity) {
+    if (capacity == 0) {
+        return;
+    }
+    for (size_t segment = 0; segment <= SegmentOf(capacity - 1); ++segment) {
+        EnsureSegment(segment);
+    }
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+bool ConcurrentSimpleVector<Type, FirstSegment, Allocator>::IsReady(size_t index) const noexcept {
+    if (index >= GetSize()) {
+        return false;
+    }
+    //  ,      
+    Slot* slots = segments_[SegmentOf(index)].load(std::memory_order_acquire);
+    return slots != nullptr && slots[index - SegmentStart(SegmentOf(index))].ready.load(std::memory_order_acquire);
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+template <typename Function>
+void ConcurrentSimpleVector<Type, FirstSegment, Allocator>::ForEachReady(Function function) const {
+    size_t size = GetSize();
+    for (size_t index = 0; index < size; ++index) {
+        if (IsReady(index)) {
+            function(index, *SlotAt(index).Get());
+        }
+    }
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+auto ConcurrentSimpleVector<Type, FirstSegment, Allocator>::EnsureSegment(size_t segment) -> Slot* {
+    std::atomic<Slot*>& published = segments_[segment];
+    Slot* slots = published.load(std::memory_order_acquire);
+    if (slots != nullptr) {
+        return slots;
+    }
+    size_t size = SegmentSize(segment);
+    Slot* fresh = std::allocator_traits<SlotAllocator>::allocate(alloc_, size);
+    std::uninitialized_value_construct_n(fresh, size);
+    if (published.compare_exchange_strong(slots, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return fresh;
+    }
+    //    ,    
+    std::destroy_n(fresh, size);
+    std::allocator_traits<SlotAllocator>::deallocate(alloc_, fresh, size);
+    return slots;
+}
+
+template <typename Type, size_t FirstSegment, typename Allocator>
+void ConcurrentSimpleVector<Type, FirstSegment, Allocator>::PrepareSegment(size_t segment) noexcept {
+    if (segment >= kMaxSegments) {
+        return;
+    }
+    try {
+        EnsureSegment(segment);
+    } catch (...) {
+    }
+}
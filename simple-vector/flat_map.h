@@ -0,0 +1,624 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "simple_vector.h"
+
+
+namespace flat_detail {
+
+//   ,   key,   .
+//     :     (cmov),
+//      size,     
+template <typename Key, typename Compare>
+size_t LowerBound(const Key* keys, size_t size, const Key& key, const Compare& less) {
+    if (size == 0) {
+        return 0;
+    }
+    const Key* base = keys;
+    while (size > 1) {
+        size_t half = size / 2;
+        base = less(base[half], key) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<size_t>(base - keys) + less(*base, key);
+}
+
+//  [first, last)       :       .
+//   
+template <typename Iterator, typename KeyOf, typename Compare>
+Iterator SortUnique(Iterator first, Iterator last, KeyOf key_of, const Compare& less) {
+    std::stable_sort(first, last, [&](const auto& lhs, const auto& rhs) { return less(key_of(lhs), key_of(rhs)); });
+    return std::unique(first, last, [&](const auto& lhs, const auto& rhs) {
+        return !less(key_of(lhs), key_of(rhs)) && !less(key_of(rhs), key_of(lhs));
+    });
+}
+
+} // namespace flat_detail
+
+//    SimpleVector.
+//  -      ,     .
+//      (O(n)),     
+//     InsertRange:     
+template <typename Key, typename Compare = std::less<Key>, typename Allocator = MallocAllocator<Key>>
+class FlatSet {
+public:
+    using ConstIterator = const Key*;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& less, const Allocator& alloc = Allocator()) : keys_(alloc), less_(less) {
+    }
+
+    //     :     
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    FlatSet(InputIt first, InputIt last, const Compare& less = Compare(), const Allocator& alloc = Allocator());
+
+    FlatSet(std::initializer_list<Key> init, const Compare& less = Compare(), const Allocator& alloc = Allocator())
+        : FlatSet(init.begin(), init.end(), less, alloc) {
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return keys_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.IsEmpty();
+    }
+
+    //  ,   key
+    ConstIterator LowerBound(const Key& key) const {
+        return begin() + flat_detail::LowerBound(keys_.begin(), keys_.GetSize(), key, less_);
+    }
+
+    // ,  key,  end()
+    ConstIterator Find(const Key& key) const {
+        ConstIterator it = LowerBound(key);
+        return it != end() && !less_(key, *it) ? it : end();
+    }
+
+    bool Contains(const Key& key) const {
+        return Find(key) != end();
+    }
+
+    ConstIterator begin() const noexcept {
+        return keys_.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return keys_.end();
+    }
+
+    //     
+    const SimpleVector<Key, Allocator>& GetKeys() const noexcept {
+        return keys_;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //  key,    .      
+    std::pair<ConstIterator, bool> Insert(const Key& key);
+
+    //    :         
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void InsertRange(InputIt first, InputIt last);
+
+    //  key.   : 0  1
+    size_t Erase(const Key& key);
+
+    ConstIterator Erase(ConstIterator pos) {
+        return keys_.Erase(pos);
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+    }
+
+    void Reserve(size_t new_capacity) {
+        keys_.Reserve(new_capacity);
+    }
+
+    void swap(FlatSet& other) noexcept {
+        keys_.swap(other.keys_);
+        std::swap(less_, other.less_);
+    }
+
+    bool operator==(const FlatSet& rhs) const {
+        return keys_ == rhs.keys_;
+    }
+
+    bool operator!=(const FlatSet& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    SimpleVector<Key, Allocator> keys_;
+    Compare less_;
+};
+
+//      SimpleVector:    .
+//       ,       .
+//    : for (auto [key, value] : map) { ... }
+template <typename Key, typename Value, typename Compare = std::less<Key>,
+          typename KeyAllocator = MallocAllocator<Key>, typename ValueAllocator = MallocAllocator<Value>>
+class FlatMap {
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& less, const KeyAllocator& key_alloc = KeyAllocator(),
+                     const ValueAllocator& value_alloc = ValueAllocator())
+        : keys_(key_alloc), values_(value_alloc), less_(less) {
+    }
+
+    //      :       .
+    //       ,    
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    FlatMap(InputIt first, InputIt last, const Compare& less = Compare(), const KeyAllocator& key_alloc = KeyAllocator(),
+            const ValueAllocator& value_alloc = ValueAllocator());
+
+    FlatMap(std::initializer_list<std::pair<Key, Value>> init, const Compare& less = Compare(),
+            const KeyAllocator& key_alloc = KeyAllocator(), const ValueAllocator& value_alloc = ValueAllocator())
+        : FlatMap(init.begin(), init.end(), less, key_alloc, value_alloc) {
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return keys_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.IsEmpty();
+    }
+
+    //    key  end()
+    Iterator Find(const Key& key) {
+        return Iterator(this, FindIndex(key));
+    }
+
+    ConstIterator Find(const Key& key) const {
+        return ConstIterator(this, FindIndex(key));
+    }
+
+    bool Contains(const Key& key) const {
+        return FindIndex(key) != GetSize();
+    }
+
+    //   .   std::out_of_range,   
+    Value& At(const Key& key);
+    const Value& At(const Key& key) const;
+
+    //   ;      Value()
+    Value& operator[](const Key& key);
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    //        ,   
+    const SimpleVector<Key, KeyAllocator>& GetKeys() const noexcept {
+        return keys_;
+    }
+
+    const SimpleVector<Value, ValueAllocator>& GetValues() const noexcept {
+        return values_;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //  ,    .      
+    std::pair<Iterator, bool> Insert(const Key& key, const Value& value) {
+        return Emplace(key, value);
+    }
+
+    std::pair<Iterator, bool> Insert(const Key& key, Value&& value) {
+        return Emplace(key, std::move(value));
+    }
+
+    //    args,    
+    template <typename... Args>
+    std::pair<Iterator, bool> Emplace(const Key& key, Args&&... args);
+
+    //       
+    template <typename V>
+    std::pair<Iterator, bool> InsertOrAssign(const Key& key, V&& value);
+
+    //      .
+    //      ,      
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void InsertRange(InputIt first, InputIt last);
+
+    //  .   : 0  1
+    size_t Erase(const Key& key);
+
+    Iterator Erase(ConstIterator pos);
+
+    void Clear() noexcept {
+        keys_.Clear();
+        values_.Clear();
+    }
+
+    void Reserve(size_t new_capacity) {
+        keys_.Reserve(new_capacity);
+        values_.Reserve(new_capacity);
+    }
+
+    void swap(FlatMap& other) noexcept {
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+        std::swap(less_, other.less_);
+    }
+
+    bool operator==(const FlatMap& rhs) const {
+        return keys_ == rhs.keys_ && values_ == rhs.values_;
+    }
+
+    bool operator!=(const FlatMap& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    SimpleVector<Key, KeyAllocator> keys_;
+    SimpleVector<Value, ValueAllocator> values_;
+    Compare less_;
+
+    size_t LowerBoundIndex(const Key& key) const {
+        return flat_detail::LowerBound(keys_.begin(), keys_.GetSize(), key, less_);
+    }
+
+    //  key  GetSize()
+    size_t FindIndex(const Key& key) const {
+        size_t index = LowerBoundIndex(key);
+        return index != GetSize() && !less_(key, keys_[index]) ? index : GetSize();
+    }
+
+    //      index.    ,  
+    template <typename... Args>
+    void InsertAt(size_t index, const Key& key, Args&&... args);
+};
+
+//  FlatMap:    .     (, )
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <bool IsConst>
+class FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::BasicIterator {
+    using Owner = std::conditional_t<IsConst, const FlatMap, FlatMap>;
+    friend class FlatMap;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<const Key, Value>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const Key&, std::conditional_t<IsConst, const Value&, Value&>>;
+    using pointer = void;
+
+    BasicIterator() = default;
+
+    //      
+    template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    BasicIterator(const BasicIterator<OtherConst>& other) noexcept : owner_(other.owner_), index_(other.index_) {
+    }
+
+    reference operator*() const noexcept {
+        assert(index_ < owner_->GetSize());
+        return reference(owner_->keys_[index_], owner_->values_[index_]);
+    }
+
+    const Key& GetKey() const noexcept {
+        return owner_->keys_[index_];
+    }
+
+    auto& GetValue() const noexcept {
+        return owner_->values_[index_];
+    }
+
+    size_t GetIndex() const noexcept {
+        return index_;
+    }
+
+    BasicIterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+        BasicIterator copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    bool operator==(const BasicIterator& rhs) const noexcept {
+        return index_ == rhs.index_;
+    }
+
+    bool operator!=(const BasicIterator& rhs) const noexcept {
+        return index_ != rhs.index_;
+    }
+
+private:
+    template <bool>
+    friend class BasicIterator;
+
+    Owner* owner_ = nullptr;
+    size_t index_ = 0;
+
+    BasicIterator(Owner* owner, size_t index) noexcept : owner_(owner), index_(index) {
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> FlatSet
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename InputIt, typename>
+FlatSet<Key, Compare, Allocator>::FlatSet(InputIt first, InputIt last, const Compare& less, const Allocator& alloc)
+    : keys_(alloc), less_(less) {
+    keys_.Append(first, last);
+    auto identity = [](const Key& key) -> const Key& { return key; };
+    keys_.Erase(flat_detail::SortUnique(keys_.begin(), keys_.end(), identity, less_), keys_.cend());
+}
+
+template <typename Key, typename Compare, typename Allocator>
+std::pair<const Key*, bool> FlatSet<Key, Compare, Allocator>::Insert(const Key& key) {
+    ConstIterator pos = LowerBound(key);
+    if (pos != end() && !less_(key, *pos)) {
+        return {pos, false};
+    }
+    return {keys_.Insert(pos, key), true};
+}
+
+template <typename Key, typename Compare, typename Allocator>
+template <typename InputIt, typename>
+void FlatSet<Key, Compare, Allocator>::InsertRange(InputIt first, InputIt last) {
+    FlatSet batch(first, last, less_, keys_.GetAllocator());
+    if (batch.IsEmpty()) {
+        return;
+    }
+    //         
+    SimpleVector<Key, Allocator> merged(keys_.GetAllocator());
+    merged.Reserve(GetSize() + batch.GetSize());
+    Key* lhs = keys_.begin();
+    Key* rhs = batch.keys_.begin();
+    while (lhs != keys_.end() && rhs != batch.keys_.end()) {
+        if (less_(*rhs, *lhs)) {
+            merged.PushBack(std::move(*rhs++));
+        }
+        else {
+            if (!less_(*lhs, *rhs)) {
+                ++rhs;
+            }
+            merged.PushBack(std::move(*lhs++));
+        }
+    }
+    merged.Append(std::make_move_iterator(lhs), std::make_move_iterator(keys_.end()));
+    merged.Append(std::make_move_iterator(rhs), std::make_move_iterator(batch.keys_.end()));
+    keys_.swap(merged);
+}
+
+template <typename Key, typename Compare, typename Allocator>
+size_t FlatSet<Key, Compare, Allocator>::Erase(const Key& key) {
+    ConstIterator pos = Find(key);
+    if (pos == end()) {
+        return 0;
+    }
+    keys_.Erase(pos);
+    return 1;
+}
+
+template <typename Key, typename Compare, typename Allocator>
+void swap(FlatSet<Key, Compare, Allocator>& lhs, FlatSet<Key, Compare, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> FlatMap
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <typename InputIt, typename>
+FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::FlatMap(InputIt first, InputIt last, const Compare& less,
+                                                                    const KeyAllocator& key_alloc,
+                                                                    const ValueAllocator& value_alloc)
+    : keys_(key_alloc), values_(value_alloc), less_(less) {
+    //       
+    using PairAllocator = typename std::allocator_traits<KeyAllocator>::template rebind_alloc<std::pair<Key, Value>>;
+    SimpleVector<std::pair<Key, Value>, PairAllocator> pairs(PairAllocator{key_alloc});
+    pairs.Append(first, last);
+    auto key_of = [](const std::pair<Key, Value>& pair) -> const Key& { return pair.first; };
+    auto unique_end = flat_detail::SortUnique(pairs.begin(), pairs.end(), key_of, less_);
+    Reserve(unique_end - pairs.begin());
+    for (auto it = pairs.begin(); it != unique_end; ++it) {
+        keys_.PushBack(std::move(it->first));
+        values_.PushBack(std::move(it->second));
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+Value& FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::At(const Key& key) {
+    size_t index = FindIndex(key);
+    if (index == GetSize()) throw std::out_of_range("key not found");
+    return values_[index];
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+const Value& FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::At(const Key& key) const {
+    size_t index = FindIndex(key);
+    if (index == GetSize()) throw std::out_of_range("key not found");
+    return values_[index];
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+Value& FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::operator[](const Key& key) {
+    return Emplace(key).first.GetValue();
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <typename... Args>
+auto FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::Emplace(const Key& key, Args&&... args)
+    -> std::pair<Iterator, bool> {
+    size_t index = LowerBoundIndex(key);
+    if (index != GetSize() && !less_(key, keys_[index])) {
+        return {Iterator(this, index), false};
+    }
+    InsertAt(index, key, std::forward<Args>(args)...);
+    return {Iterator(this, index), true};
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <typename V>
+auto FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::InsertOrAssign(const Key& key, V&& value)
+    -> std::pair<Iterator, bool> {
+    size_t index = LowerBoundIndex(key);
+    if (index != GetSize() && !less_(key, keys_[index])) {
+        values_[index] = std::forward<V>(value);
+        return {Iterator(this, index), false};
+    }
+    InsertAt(index, key, std::forward<V>(value));
+    return {Iterator(this, index), true};
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <typename InputIt, typename>
+void FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::InsertRange(InputIt first, InputIt last) {
+    FlatMap batch(first, last, less_, keys_.GetAllocator(), values_.GetAllocator());
+    if (batch.IsEmpty()) {
+        return;
+    }
+    //  ,         
+    FlatMap merged(less_, keys_.GetAllocator(), values_.GetAllocator());
+    merged.Reserve(GetSize() + batch.GetSize());
+    size_t lhs = 0;
+    size_t rhs = 0;
+    auto take = [&merged](FlatMap& from, size_t index) {
+        merged.keys_.PushBack(std::move(from.keys_[index]));
+        merged.values_.PushBack(std::move(from.values_[index]));
+    };
+    while (lhs < GetSize() && rhs < batch.GetSize()) {
+        if (less_(batch.keys_[rhs], keys_[lhs])) {
+            take(batch, rhs++);
+        }
+        else {
+            if (!less_(keys_[lhs], batch.keys_[rhs])) {
+                ++rhs;
+            }
+            take(*this, lhs++);
+        }
+    }
+    for (; lhs < GetSize(); ++lhs) {
+        take(*this, lhs);
+    }
+    for (; rhs < batch.GetSize(); ++rhs) {
+        take(batch, rhs);
+    }
+    swap(merged);
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+size_t FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::Erase(const Key& key) {
+    size_t index = FindIndex(key);
+    if (index == GetSize()) {
+        return 0;
+    }
+    keys_.Erase(keys_.cbegin() + index);
+    values_.Erase(values_.cbegin() + index);
+    return 1;
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+auto FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::Erase(ConstIterator pos) -> Iterator {
+    assert(pos.index_ < GetSize());
+    keys_.Erase(keys_.cbegin() + pos.index_);
+    values_.Erase(values_.cbegin() + pos.index_);
+    return Iterator(this, pos.index_);
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+template <typename... Args>
+void FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>::InsertAt(size_t index, const Key& key, Args&&... args) {
+    keys_.Insert(keys_.cbegin() + index, key);
+    try {
+        values_.Emplace(values_.cbegin() + index, std::forward<Args>(args)...);
+    } catch (...) {
+        keys_.Erase(keys_.cbegin() + index);
+        throw;
+    }
+}
+
+template <typename Key, typename Value, typename Compare, typename KeyAllocator, typename ValueAllocator>
+void swap(FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>& lhs,
+          FlatMap<Key, Value, Compare, KeyAllocator, ValueAllocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
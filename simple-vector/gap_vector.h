@@ -0,0 +1,643 @@
+#pragma once
+#include <cassert>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <iterator>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "array_ptr.h"
+#include "growth_policy.h"
+
+
+//         .
+//    [0, gap_begin_)  [gap_end_, cap_),    ,   - .
+//       O(1) ,   - ,
+//    .     , Compact() 
+//        
+template <typename Type, typename Allocator = MallocAllocator<Type>, typename GrowthPolicy = GrowByDoubling>
+class GapVector {
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GapVector() noexcept = default;
+
+    //   ,    alloc
+    explicit GapVector(const Allocator& alloc) noexcept;
+
+    //    std::initializer_list,    
+    GapVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator());
+
+    GapVector(const GapVector& other);
+    //  other   , other  
+    GapVector(GapVector&& other) noexcept;
+
+    GapVector& operator=(const GapVector& rhs);
+    GapVector& operator=(GapVector&& rhs) noexcept;
+
+    ~GapVector();
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return cap_ - (gap_end_ - gap_begin_);
+    }
+
+    size_t GetCapacity() const noexcept {
+        return cap_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //  ,    
+    size_t GetCursor() const noexcept {
+        return gap_begin_;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return buffer_[Physical(index)];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return buffer_[Physical(index)];
+    }
+
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return buffer_[Physical(index)];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return buffer_[Physical(index)];
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //     index (index == size -  ).
+    //        
+    void SetCursor(size_t index);
+
+    //    ,    
+    template <typename... Args>
+    Type& EmplaceAtCursor(Args&&... args);
+
+    void InsertAtCursor(const Type& value) {
+        EmplaceAtCursor(value);
+    }
+
+    void InsertAtCursor(Type&& value) {
+        EmplaceAtCursor(std::move(value));
+    }
+
+    //    ,  Backspace.      
+    void EraseBeforeCursor() noexcept;
+
+    //    ,  Delete.      
+    void EraseAfterCursor() noexcept;
+
+    //   ,    ,     .
+    //        
+    Type* Compact();
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //  SimpleVector  :      pos
+
+    void Clear() noexcept;
+
+    void PushBack(const Type& item);
+    void PushBack(Type&& item);
+
+    //    ,    .     
+    void PopBack();
+
+    //     pos     .    
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args);
+
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        return Emplace(pos, value);
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    //     pos,     
+    Iterator Erase(ConstIterator pos);
+
+    //   new_capacity 
+    void Reserve(size_t new_capacity);
+
+    void swap(GapVector& other) noexcept;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>> 
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool operator==(const GapVector& rhs) const {
+        return GetSize() == rhs.GetSize() && std::equal(begin(), end(), rhs.begin());
+    }
+
+    bool operator!=(const GapVector& rhs) const {
+        return !(*this == rhs);
+    }
+
+    bool operator<(const GapVector& rhs) const {
+        return std::lexicographical_compare(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    bool operator<=(const GapVector& rhs) const {
+        return !(rhs < *this);
+    }
+
+    bool operator>(const GapVector& rhs) const {
+        return rhs < *this;
+    }
+
+    bool operator>=(const GapVector& rhs) const {
+        return !(*this < rhs);
+    }
+
+private:
+    ArrayPtr<Type, Allocator> buffer_;
+    size_t cap_ = 0;
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+
+    //      
+    size_t Physical(size_t index) const noexcept {
+        return index < gap_begin_ ? index : index + (gap_end_ - gap_begin_);
+    }
+
+    //   new_cap ,  
+    void Reallocate(size_t new_cap);
+
+    // count   from  to,  
+    static void Relocate(Type* from, size_t count, Type* to);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//     ,    ,
+//       
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <bool IsConst>
+class GapVector<Type, Allocator, GrowthPolicy>::BasicIterator {
+    using Owner = std::conditional_t<IsConst, const GapVector, GapVector>;
+    friend class GapVector;
+    template <bool>
+    friend class BasicIterator;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+    using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+    BasicIterator() noexcept = default;
+
+    //      
+    template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    BasicIterator(const BasicIterator<OtherConst>& other) noexcept : owner_(other.owner_), index_(other.index_) {
+    }
+
+    reference operator*() const noexcept {
+        return (*owner_)[index_];
+    }
+
+    pointer operator->() const noexcept {
+        return &(*owner_)[index_];
+    }
+
+    reference operator[](difference_type offset) const noexcept {
+        return (*owner_)[index_ + offset];
+    }
+
+    BasicIterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+        BasicIterator copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    BasicIterator& operator--() noexcept {
+        --index_;
+        return *this;
+    }
+
+    BasicIterator operator--(int) noexcept {
+        BasicIterator copy = *this;
+        --index_;
+        return copy;
+    }
+
+    BasicIterator& operator+=(difference_type offset) noexcept {
+        index_ += offset;
+        return *this;
+    }
+
+    BasicIterator& operator-=(difference_type offset) noexcept {
+        index_ -= offset;
+        return *this;
+    }
+
+    BasicIterator operator+(difference_type offset) const noexcept {
+        return BasicIterator(owner_, index_ + offset);
+    }
+
+    friend BasicIterator operator+(difference_type offset, const BasicIterator& it) noexcept {
+        return it + offset;
+    }
+
+    BasicIterator operator-(difference_type offset) const noexcept {
+        return BasicIterator(owner_, index_ - offset);
+    }
+
+    difference_type operator-(const BasicIterator& other) const noexcept {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const BasicIterator& other) const noexcept {
+        return index_ == other.index_;
+    }
+
+    bool operator!=(const BasicIterator& other) const noexcept {
+        return index_ != other.index_;
+    }
+
+    bool operator<(const BasicIterator& other) const noexcept {
+        return index_ < other.index_;
+    }
+
+    bool operator<=(const BasicIterator& other) const noexcept {
+        return index_ <= other.index_;
+    }
+
+    bool operator>(const BasicIterator& other) const noexcept {
+        return index_ > other.index_;
+    }
+
+    bool operator>=(const BasicIterator& other) const noexcept {
+        return index_ >= other.index_;
+    }
+
+    //   
+    size_t GetIndex() const noexcept {
+        return index_;
+    }
+
+private:
+    Owner* owner_ = nullptr;
+    size_t index_ = 0;
+
+    BasicIterator(Owner* owner, size_t index) noexcept : owner_(owner), index_(index) {
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>::GapVector(const Allocator& alloc) noexcept : buffer_(alloc) {
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>::GapVector(std::initializer_list<Type> init, const Allocator& alloc)
+    : buffer_(init.size(), alloc), cap_(init.size()) {
+    std::uninitialized_copy(init.begin(), init.end(), buffer_.Get());
+    gap_begin_ = gap_end_ = init.size();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>::GapVector(const GapVector& other)
+    : buffer_(other.cap_, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.buffer_.GetAllocator())),
+    cap_(other.cap_) {
+    //    ,        
+    Type* data = buffer_.Get();
+    std::uninitialized_copy_n(other.buffer_.Get(), other.gap_begin_, data);
+    try {
+        std::uninitialized_copy(other.buffer_.Get() + other.gap_end_, other.buffer_.Get() + other.cap_, data + other.gap_end_);
+    } catch (...) {
+        std::destroy_n(data, other.gap_begin_);
+        throw;
+    }
+    gap_begin_ = other.gap_begin_;
+    gap_end_ = other.gap_end_;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>::GapVector(GapVector&& other) noexcept
+    : buffer_(std::move(other.buffer_)), cap_(std::exchange(other.cap_, 0)),
+    gap_begin_(std::exchange(other.gap_begin_, 0)), gap_end_(std::exchange(other.gap_end_, 0)) {
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>& GapVector<Type, Allocator, GrowthPolicy>::operator=(const GapVector& rhs) {
+    if (this != &rhs) {
+        GapVector copy(rhs);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>& GapVector<Type, Allocator, GrowthPolicy>::operator=(GapVector&& rhs) noexcept {
+    GapVector moved(std::move(rhs));
+    swap(moved);
+    return *this;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+GapVector<Type, Allocator, GrowthPolicy>::~GapVector() {
+    Clear();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::SetCursor(size_t index) {
+    assert(index <= GetSize());
+    if (gap_begin_ == gap_end_) {
+        // ,    
+        gap_begin_ = gap_end_ = index;
+        return;
+    }
+    Type* data = buffer_.Get();
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (index < gap_begin_) {
+            size_t count = gap_begin_ - index;
+            std::memmove(static_cast<void*>(data + gap_end_ - count), data + index, count * sizeof(Type));
+            gap_begin_ -= count;
+            gap_end_ -= count;
+        }
+        else if (index > gap_begin_) {
+            size_t count = index - gap_begin_;
+            std::memmove(static_cast<void*>(data + gap_begin_), data + gap_end_, count * sizeof(Type));
+            gap_begin_ += count;
+            gap_end_ += count;
+        }
+    }
+    else {
+        //  :   ,   
+        while (index < gap_begin_) {
+            new (data + gap_end_ - 1) Type(std::move(data[gap_begin_ - 1]));
+            std::destroy_at(data + gap_begin_ - 1);
+            --gap_begin_;
+            --gap_end_;
+        }
+        while (index > gap_begin_) {
+            new (data + gap_begin_) Type(std::move(data[gap_end_]));
+            std::destroy_at(data + gap_end_);
+            ++gap_begin_;
+            ++gap_end_;
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+Type& GapVector<Type, Allocator, GrowthPolicy>::EmplaceAtCursor(Args&&... args) {
+    if (gap_begin_ == gap_end_) {
+        //     ,     
+        Type value(std::forward<Args>(args)...);
+        Reallocate(GrowthPolicy::Grow(cap_, GetSize() + 1, sizeof(Type)));
+        new (buffer_.Get() + gap_begin_) Type(std::move(value));
+    }
+    else {
+        new (buffer_.Get() + gap_begin_) Type(std::forward<Args>(args)...);
+    }
+    return buffer_[gap_begin_++];
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::EraseBeforeCursor() noexcept {
+    assert(gap_begin_ > 0);
+    std::destroy_at(buffer_.Get() + --gap_begin_);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::EraseAfterCursor() noexcept {
+    assert(gap_end_ < cap_);
+    std::destroy_at(buffer_.Get() + gap_end_++);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type* GapVector<Type, Allocator, GrowthPolicy>::Compact() {
+    SetCursor(GetSize());
+    return buffer_.Get();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  ===>
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::Clear() noexcept {
+    std::destroy_n(buffer_.Get(), gap_begin_);
+    std::destroy(buffer_.Get() + gap_end_, buffer_.Get() + cap_);
+    gap_begin_ = 0;
+    gap_end_ = cap_;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::PushBack(const Type& item) {
+    Emplace(cend(), item);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::PushBack(Type&& item) {
+    Emplace(cend(), std::move(item));
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::PopBack() {
+    assert(!IsEmpty());
+    SetCursor(GetSize());
+    EraseBeforeCursor();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+typename GapVector<Type, Allocator, GrowthPolicy>::Iterator
+GapVector<Type, Allocator, GrowthPolicy>::Emplace(ConstIterator pos, Args&&... args) {
+    size_t index = pos.GetIndex();
+    assert(index <= GetSize());
+    if (index == gap_begin_) {
+        EmplaceAtCursor(std::forward<Args>(args)...);
+    }
+    else {
+        //    ,    
+        Type value(std::forward<Args>(args)...);
+        SetCursor(index);
+        EmplaceAtCursor(std::move(value));
+    }
+    return Iterator(this, index);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+typename GapVector<Type, Allocator, GrowthPolicy>::Iterator
+GapVector<Type, Allocator, GrowthPolicy>::Erase(ConstIterator pos) {
+    size_t index = pos.GetIndex();
+    assert(index < GetSize());
+    SetCursor(index);
+    EraseAfterCursor();
+    return Iterator(this, index);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::Reserve(size_t new_capacity) {
+    if (new_capacity > cap_) {
+        Reallocate(new_capacity);
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::swap(GapVector& other) noexcept {
+    buffer_.swap(other.buffer_);
+    std::swap(cap_, other.cap_);
+    std::swap(gap_begin_, other.gap_begin_);
+    std::swap(gap_end_, other.gap_end_);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  ===>
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::Reallocate(size_t new_cap) {
+    //     ,   -     
+    ArrayPtr<Type, Allocator> fresh(new_cap, buffer_.GetAllocator());
+    size_t tail = cap_ - gap_end_;
+    Relocate(buffer_.Get(), gap_begin_, fresh.Get());
+    Relocate(buffer_.Get() + gap_end_, tail, fresh.Get() + new_cap - tail);
+    buffer_.swap(fresh);
+    cap_ = new_cap;
+    gap_end_ = new_cap - tail;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void GapVector<Type, Allocator, GrowthPolicy>::Relocate(Type* from, size_t count, Type* to) {
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(to), from, count * sizeof(Type));
+        }
+    }
+    else {
+        std::uninitialized_move_n(from, count, to);
+        std::destroy_n(from, count);
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void swap(GapVector<Type, Allocator, GrowthPolicy>& lhs, GapVector<Type, Allocator, GrowthPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
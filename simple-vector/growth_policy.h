@@ -0,0 +1,58 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+
+//    SimpleVector.
+// Grow(capacity, required, element_size)      required
+
+// ,     1
+struct GrowByDoubling {
+    static constexpr size_t Grow(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity > 0 ? capacity * 2 : 1, required);
+    }
+};
+
+//   1.5 .       
+//  ,        
+struct GrowByHalf {
+    static constexpr size_t Grow(size_t capacity, size_t required, size_t) noexcept {
+        return std::max(capacity + capacity / 2 + 1, required);
+    }
+};
+
+//          :
+//  128   16,       .
+// ,  malloc    ,  
+struct GrowToSizeClass {
+    static constexpr size_t Grow(size_t capacity, size_t required, size_t element_size) noexcept {
+        size_t wanted = std::max(capacity > 0 ? capacity * 2 : 1, required);
+        return RoundUpBytes(wanted * element_size) / element_size;
+    }
+
+    static constexpr size_t RoundUpBytes(size_t bytes) noexcept {
+        if (bytes <= 128) {
+            return (bytes + 15) / 16 * 16;
+        }
+        size_t power = 128;
+        while (power * 2 < bytes) {
+            power *= 2;
+        }
+        size_t step = power / 4;
+        return (bytes + step - 1) / step * step;
+    }
+};
+
+//    ,     1.5   ,
+//          
+template <size_t PageSize = 4096, size_t LargeBytes = 64 * 4096>
+struct GrowByPages {
+    static constexpr size_t Grow(size_t capacity, size_t required, size_t element_size) noexcept {
+        if (capacity * element_size < LargeBytes) {
+            return GrowByDoubling::Grow(capacity, required, element_size);
+        }
+        size_t wanted = std::max(capacity + capacity / 2, required) * element_size;
+        size_t bytes = (wanted + PageSize - 1) / PageSize * PageSize;
+        return bytes / element_size;
+    }
+};
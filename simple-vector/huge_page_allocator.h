@@ -0,0 +1,146 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include "malloc_allocator.h"
+
+
+//    .
+//   ThresholdBytes  malloc,    mmap,
+//   2    MADV_HUGEPAGE,     huge-.
+//     ,  allocate_zeroed   ,
+//  reallocate      mremap  ,
+//     :      2 .
+//    GrowByPages<kHugePageSize, ThresholdBytes>
+template <typename Type, size_t ThresholdBytes = 4 * 1024 * 1024>
+class HugePageAllocator {
+public:
+    using value_type = Type;
+
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    template <typename Other>
+    struct rebind {
+        using other = HugePageAllocator<Other, ThresholdBytes>;
+    };
+
+    HugePageAllocator() noexcept = default;
+
+    template <typename Other>
+    HugePageAllocator(const HugePageAllocator<Other, ThresholdBytes>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        if (IsMapped(n)) {
+            return static_cast<Type*>(Map(MappedBytes(n)));
+        }
+        return small_.allocate(n);
+    }
+
+    Type* allocate_zeroed(size_t n) {
+        if (IsMapped(n)) {
+            return static_cast<Type*>(Map(MappedBytes(n)));
+        }
+        return small_.allocate_zeroed(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        if (IsMapped(n)) {
+            munmap(ptr, MappedBytes(n));
+        }
+        else {
+            small_.deallocate(ptr, n);
+        }
+    }
+
+    //   ,   
+    Type* reallocate(Type* ptr, size_t old_n, size_t new_n) {
+        if (ptr == nullptr) {
+            return allocate(new_n);
+        }
+        bool old_mapped = IsMapped(old_n);
+        bool new_mapped = IsMapped(new_n);
+        if (!old_mapped && !new_mapped) {
+            return small_.reallocate(ptr, old_n, new_n);
+        }
+#ifdef __linux__
+        if (old_mapped && new_mapped) {
+            const size_t old_bytes = MappedBytes(old_n);
+            const size_t new_bytes = MappedBytes(new_n);
+            if (old_bytes == new_bytes) {
+                return ptr;
+            }
+            // :           
+            if (mremap(ptr, old_bytes, new_bytes, 0) != MAP_FAILED) {
+                Advise(ptr, new_bytes);
+                return ptr;
+            }
+            //  MREMAP_MAYMOVE    2 .  
+            //     , -  
+            void* target = Map(new_bytes);
+            void* moved = mremap(ptr, old_bytes, new_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (moved == MAP_FAILED) {
+                munmap(target, new_bytes);
+                throw std::bad_alloc();
+            }
+            Advise(moved, new_bytes);
+            return static_cast<Type*>(moved);
+        }
+#endif
+        //  :       
+        Type* fresh = allocate(new_n);
+        std::memcpy(static_cast<void*>(fresh), ptr, (old_n < new_n ? old_n : new_n) * sizeof(Type));
+        deallocate(ptr, old_n);
+        return fresh;
+    }
+
+private:
+    MallocAllocator<Type> small_;
+
+    //n * sizeof(Type) >= ThresholdBytes   
+    static bool IsMapped(size_t n) noexcept {
+        return n >= (ThresholdBytes + sizeof(Type) - 1) / sizeof(Type);
+    }
+
+    // std::bad_array_new_length,        size_t
+    static size_t MappedBytes(size_t n) {
+        return allocator_detail::AlignedBytes<Type>(n, kHugePageSize);
+    }
+
+    // bytes      huge-:    
+    static void* Map(size_t bytes) {
+        size_t padded = bytes + kHugePageSize;
+        void* raw = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) throw std::bad_alloc();
+        uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (begin + kHugePageSize - 1) & ~uintptr_t(kHugePageSize - 1);
+        if (aligned > begin) {
+            munmap(raw, aligned - begin);
+        }
+        size_t tail = begin + padded - (aligned + bytes);
+        if (tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+        }
+        Advise(reinterpret_cast<void*>(aligned), bytes);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    static void Advise([[maybe_unused]] void* ptr, [[maybe_unused]] size_t bytes) noexcept {
+#ifdef MADV_HUGEPAGE
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+    }
+};
+
+template <typename Lhs, typename Rhs, size_t Threshold>
+bool operator==(const HugePageAllocator<Lhs, Threshold>&, const HugePageAllocator<Rhs, Threshold>&) noexcept {
+    return true;
+}
+
+template <typename Lhs, typename Rhs, size_t Threshold>
+bool operator!=(const HugePageAllocator<Lhs, Threshold>&, const HugePageAllocator<Rhs, Threshold>&) noexcept {
+    return false;
+}
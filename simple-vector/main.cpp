@@ -1,9 +1,41 @@
 #include "simple_vector.h"
+#include "memory_resource.h"
+#include "small_simple_vector.h"
+#include "huge_page_allocator.h"
+#include "mapped_simple_vector.h"
+#include "serialization.h"
+#include "simd_kernels.h"
+#include "concurrent_simple_vector.h"
+#include "gap_vector.h"
+#include "soa_vector.h"
+#include "aligned_allocator.h"
+#include "shared_simple_vector.h"
+#include "flat_map.h"
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <filesystem>
 #include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <vector>
 #include <numeric>
+#include <random>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 
 using namespace std;
 
@@ -32,6 +64,64 @@ private:
     size_t x_;
 };
 
+// Считает живые экземпляры и не имеет конструктора по умолчанию
+class Counted {
+public:
+    explicit Counted(int value)
+        : value_(value) {
+        ++alive;
+    }
+    Counted(const Counted& other)
+        : value_(other.value_) {
+        ++alive;
+    }
+    Counted(Counted&& other) noexcept
+        : value_(other.value_) {
+        ++alive;
+    }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+    ~Counted() {
+        --alive;
+    }
+    int GetValue() const {
+        return value_;
+    }
+
+    inline static int alive = 0;
+
+private:
+    int value_;
+};
+
+// Владеющий дескриптор: не тривиально копируемый, но переносимый побайтно
+class Handle {
+public:
+    explicit Handle(int value)
+        : ptr_(new int(value)) {
+    }
+    Handle(Handle&& other) noexcept
+        : ptr_(exchange(other.ptr_, nullptr)) {
+    }
+    Handle& operator=(Handle&& other) noexcept {
+        swap(ptr_, other.ptr_);
+        return *this;
+    }
+    ~Handle() {
+        delete ptr_;
+    }
+    int GetValue() const {
+        return *ptr_;
+    }
+
+private:
+    int* ptr_;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type {
+};
+
 SimpleVector<int> GenerateVector(size_t size) {
     SimpleVector<int> v(size);
     iota(v.begin(), v.end(), 1);
@@ -150,6 +240,1484 @@ void TestNoncopiableErase() {
     cout << "Done!"s << endl << endl;
 }
 
+void TestRawStorage() {
+    cout << "Test raw storage, no default construction of capacity"s << endl;
+    {
+        SimpleVector<Counted> v(Reserve(100));
+        assert(v.GetCapacity() == 100);
+        assert(Counted::alive == 0);
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(Counted(i));
+        }
+        assert(Counted::alive == 10);
+        v.Insert(v.begin() + 5, Counted(42));
+        assert(v[5].GetValue() == 42 && Counted::alive == 11);
+        v.Erase(v.begin());
+        v.PopBack();
+        assert(Counted::alive == 9);
+        v.PushBack(v[0]);
+        assert(v[9].GetValue() == v[0].GetValue());
+        v.Clear();
+        assert(Counted::alive == 0);
+        v.PushBack(Counted(7));
+    }
+    assert(Counted::alive == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestResourceAllocators() {
+    cout << "Test arena and pool backed vectors"s << endl;
+    MonotonicArena arena;
+    {
+        SimpleVector<int, ResourceAllocator<int>> v(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        SimpleVector<int, ResourceAllocator<int>> copy(v);
+        assert(copy.GetAllocator() == v.GetAllocator());
+        assert(copy.GetSize() == 1000 && copy[999] == 999);
+        v.Resize(3000);
+        assert(v[999] == 999 && v[2999] == 0);
+    }
+    assert(arena.GetReservedBytes() > 0);
+    arena.Reset();
+    assert(arena.GetReservedBytes() == 0);
+
+    PoolResource pool;
+    {
+        SimpleVector<string, ResourceAllocator<string>> v(Reserve(4), &pool);
+        for (int i = 0; i < 100; ++i) {
+            v.Insert(v.begin(), to_string(i));
+        }
+        assert(v.GetSize() == 100 && v[0] == "99"s && v[99] == "0"s);
+        SimpleVector<char, ResourceAllocator<char>> big(100000, 'x', &pool);
+        assert(big[99999] == 'x');
+        try {
+            v.Reserve(numeric_limits<size_t>::max() / sizeof(string) + 1);
+            assert(false);
+        } catch (const bad_array_new_length&) {
+        }
+        assert(v.GetSize() == 100 && v[0] == "99"s);
+    }
+    pool.Reset();
+    cout << "Done!"s << endl << endl;
+}
+
+void TestTriviallyRelocatableGrowth() {
+    cout << "Test trivially relocatable growth"s << endl;
+    const int size = 100000;
+    SimpleVector<int> ints;
+    for (int i = 0; i < size; ++i) {
+        ints.PushBack(i);
+    }
+    ints.Insert(ints.begin() + 1, -1);
+    ints.Insert(ints.begin() + 5, ints[0]);
+    assert(ints.GetSize() == size + 2 && ints[1] == -1 && ints[5] == 0 && ints[size + 1] == size - 1);
+
+    SimpleVector<Handle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.Insert(handles.end(), Handle(i));
+    }
+    handles.Reserve(5000);
+    handles.Insert(handles.begin(), Handle(-1));
+    assert(handles[0].GetValue() == -1 && handles[1000].GetValue() == 999);
+
+    SimpleVector<int, ResourceAllocator<int>> pooled;
+    for (int i = 0; i < 1000; ++i) {
+        pooled.Insert(pooled.begin(), i);
+    }
+    assert(pooled[0] == 999 && pooled[999] == 0);
+
+    //Вместимость, размер которой в байтах не помещается в size_t, не выделяется
+    SimpleVector<int> oversized;
+    try {
+        oversized.Reserve((size_t(1) << 62) + 1);
+        assert(false);
+    } catch (const bad_array_new_length&) {
+    }
+    assert(oversized.GetCapacity() == 0);
+    MallocAllocator<int> malloc_alloc;
+    try {
+        [[maybe_unused]] int* ptr = malloc_alloc.allocate_zeroed(numeric_limits<size_t>::max() / 2);
+        assert(false);
+    } catch (const bad_array_new_length&) {
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSmallSimpleVector() {
+    cout << "Test small buffer vector"s << endl;
+    SmallSimpleVector<string, 4> v;
+    for (int i = 0; i < 4; ++i) {
+        v.PushBack(to_string(i));
+    }
+    assert(v.IsInline() && v.GetCapacity() == 4);
+    v.Insert(v.begin(), v[3]);
+    assert(!v.IsInline() && v.GetSize() == 5 && v[0] == "3"s && v[4] == "3"s);
+    v.Erase(v.begin() + 1);
+    assert(v[1] == "1"s);
+
+    SmallSimpleVector<string, 4> copy(v);
+    assert(copy == v);
+    SmallSimpleVector<string, 4> moved(move(v));
+    assert(moved == copy && v.IsEmpty() && v.IsInline());
+
+    SmallSimpleVector<X, 2> inline_moved;
+    inline_moved.PushBack(X(1));
+    SmallSimpleVector<X, 2> target(move(inline_moved));
+    assert(target.IsInline() && target[0].GetX() == 1 && inline_moved.IsEmpty());
+
+    SmallSimpleVector<int, 8> ints{1, 2, 3};
+    SmallSimpleVector<int, 8> other(20, 7);
+    ints.swap(other);
+    assert(ints.GetSize() == 20 && other.GetSize() == 3 && other[2] == 3);
+    ints.Resize(2);
+    assert(ints.GetSize() == 2 && other < ints);
+
+    //Обмен не перевыделяет память: куча меняется указателями, встроенные элементы - поэлементно
+    static_assert(noexcept(declval<SmallSimpleVector<string, 4>&>().swap(declval<SmallSimpleVector<string, 4>&>())));
+    SmallSimpleVector<string, 4> three{"a"s, "b"s, "c"s};
+    SmallSimpleVector<string, 4> one{"x"s};
+    three.swap(one);
+    assert(three == (SmallSimpleVector<string, 4>{"x"s}) && one == (SmallSimpleVector<string, 4>{"a"s, "b"s, "c"s}));
+    assert(three.IsInline() && one.IsInline());
+    SmallSimpleVector<string, 4> heap{"1"s, "2"s, "3"s, "4"s, "5"s};
+    const string* heap_data = &heap[0];
+    one.swap(heap);
+    assert(one.IsInline() == false && &one[0] == heap_data && one.GetSize() == 5 && one[4] == "5"s);
+    assert(heap.IsInline() && heap.GetCapacity() == 4 && heap == (SmallSimpleVector<string, 4>{"a"s, "b"s, "c"s}));
+    heap.swap(one);
+    assert(&heap[0] == heap_data && one.IsInline() && one[2] == "c"s);
+    SmallSimpleVector<string, 4> other_heap(6, "y"s);
+    const string* other_data = &other_heap[0];
+    heap.swap(other_heap);
+    assert(&heap[0] == other_data && &other_heap[0] == heap_data && heap.GetSize() == 6 && other_heap.GetSize() == 5);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestEmplace() {
+    cout << "Test emplace"s << endl;
+    SimpleVector<pair<string, int>> v;
+    auto& first = v.EmplaceBack("one"s, 1);
+    assert(first.first == "one"s && v.GetSize() == 1);
+    v.EmplaceBack(string(3, 'x'), 3);
+    auto it = v.Emplace(v.begin() + 1, "two"s, 2);
+    assert(it == v.begin() + 1 && it->second == 2);
+    v.Emplace(v.begin(), v[2]);
+    assert(v.GetSize() == 4 && v[0].first == "xxx"s && v[3].first == "xxx"s);
+
+    SimpleVector<Counted> counted(Reserve(2));
+    counted.EmplaceBack(5);
+    counted.Emplace(counted.begin(), 4);
+    counted.Emplace(counted.end(), 6);
+    assert(counted[0].GetValue() == 4 && counted[2].GetValue() == 6);
+
+    SmallSimpleVector<X, 1> small;
+    small.EmplaceBack(2u);
+    small.Emplace(small.begin(), 1u);
+    assert(!small.IsInline() && small[0].GetX() == 1 && small[1].GetX() == 2);
+    cout << "Done!"s << endl << endl;
+}
+
+//Прямой итератор по массиву, бросающий исключение при разыменовании элемента fail_at
+template <typename T>
+class ThrowingIterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type = T;
+    using difference_type = ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    ThrowingIterator(const T* ptr, const T* fail_at)
+        : ptr_(ptr), fail_at_(fail_at) {
+    }
+
+    reference operator*() const {
+        if (ptr_ == fail_at_) {
+            throw runtime_error("unreadable element");
+        }
+        return *ptr_;
+    }
+
+    ThrowingIterator& operator++() {
+        ++ptr_;
+        return *this;
+    }
+
+    ThrowingIterator operator++(int) {
+        ThrowingIterator copy = *this;
+        ++ptr_;
+        return copy;
+    }
+
+    bool operator==(const ThrowingIterator& rhs) const {
+        return ptr_ == rhs.ptr_;
+    }
+
+    bool operator!=(const ThrowingIterator& rhs) const {
+        return ptr_ != rhs.ptr_;
+    }
+
+private:
+    const T* ptr_;
+    const T* fail_at_;
+};
+
+//Вставляет source в середину vector, бросая исключение на втором элементе, и проверяет, что vector не изменился
+template <typename Vector, typename T>
+void CheckFailedInsertKeepsVector(Vector& vector, const T (&source)[3]) {
+    const Vector before = vector;
+    bool thrown = false;
+    try {
+        vector.Insert(vector.begin() + 1, ThrowingIterator<T>(source, source + 1), ThrowingIterator<T>(source + 3, source + 1));
+    } catch (const runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && vector == before);
+}
+
+void TestRangeInsert() {
+    cout << "Test range append and insert"s << endl;
+    SimpleVector<int> v{1, 2, 3};
+    const int extra[] = {4, 5, 6, 7};
+    v.Append(begin(extra), end(extra));
+    assert(v.GetSize() == 7 && v[6] == 7);
+    v.Insert(v.begin() + 1, 3, 0);
+    assert(v.GetSize() == 10 && v[1] == 0 && v[3] == 0 && v[4] == 2);
+    v.Insert(v.begin(), {-2, -1});
+    assert(v[0] == -2 && v[2] == 1 && v.GetSize() == 12);
+    v.Insert(v.end(), 2, v[0]);
+    assert(v[12] == -2 && v[13] == -2);
+
+    SimpleVector<string> words{"a"s, "e"s};
+    list<string> middle{"b"s, "c"s, "d"s};
+    auto it = words.Insert(words.begin() + 1, middle.begin(), middle.end());
+    assert(*it == "b"s && words.GetSize() == 5 && words[4] == "e"s);
+    words.Reserve(20);
+    words.Insert(words.begin(), 2, "z"s);
+    assert(words[0] == "z"s && words[2] == "a"s && words[6] == "e"s);
+
+    istringstream input("x y"s);
+    words.Insert(words.begin() + 2, istream_iterator<string>(input), istream_iterator<string>());
+    assert(words.GetSize() == 9 && words[2] == "x"s && words[3] == "y"s && words[4] == "a"s);
+
+    SimpleVector<Counted> counted;
+    counted.Insert(counted.begin(), 4, Counted(1));
+    assert(Counted::alive == 4);
+    counted.Insert(counted.begin() + 2, {Counted(2), Counted(3)});
+    assert(counted[2].GetValue() == 2 && counted[5].GetValue() == 1 && Counted::alive == 6);
+
+    //Исключение посреди вставки диапазона: на месте, с ростом через новый буфер и через realloc
+    const string letters[] = {"p"s, "q"s, "r"s};
+    SimpleVector<string> in_place{"a"s, "b"s, "c"s, "d"s};
+    in_place.Reserve(10);
+    CheckFailedInsertKeepsVector(in_place, letters);
+    SimpleVector<string> full{"a"s, "b"s};
+    full.ShrinkToFit();
+    CheckFailedInsertKeepsVector(full, letters);
+    const int digits[] = {7, 8, 9};
+    SimpleVector<int> ints{1, 2, 3};
+    CheckFailedInsertKeepsVector(ints, digits);
+    ints.Reserve(10);
+    CheckFailedInsertKeepsVector(ints, digits);
+    in_place.Insert(in_place.begin() + 1, begin(letters), end(letters));
+    assert(in_place.GetSize() == 7 && in_place[1] == "p"s && in_place[4] == "b"s && in_place[6] == "d"s);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestGrowthPolicies() {
+    cout << "Test growth policies and shrink to fit"s << endl;
+    SimpleVector<int, MallocAllocator<int>, GrowByHalf> half;
+    for (int i = 0; i < 10; ++i) {
+        half.PushBack(i);
+    }
+    assert(half.GetCapacity() == 11 && half[9] == 9);
+
+    SimpleVector<char, MallocAllocator<char>, GrowToSizeClass> bytes;
+    bytes.PushBack('a');
+    assert(bytes.GetCapacity() == 16);
+    bytes.Insert(bytes.end(), 150, 'b');
+    assert(bytes.GetCapacity() == 160 && bytes.GetSize() == 151);
+
+    SimpleVector<double, MallocAllocator<double>, GrowByPages<>> pages(Reserve(64 * 512));
+    pages.Resize(64 * 512);
+    pages.PushBack(1.0);
+    assert(pages.GetCapacity() * sizeof(double) % 4096 == 0 && pages.GetCapacity() == 64 * 512 * 3 / 2);
+
+    SimpleVector<string> words(100, "w"s);
+    words.Reserve(1000);
+    words.Resize(10);
+    words.ShrinkToFit();
+    assert(words.GetCapacity() == 10 && words[9] == "w"s);
+    words.Clear();
+    words.ShrinkToFit();
+    assert(words.GetCapacity() == 0 && words.begin() == nullptr);
+    half.ShrinkToFit();
+    assert(half.GetCapacity() == 10 && half[9] == 9);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestMoveIsPointerSteal() {
+    cout << "Test noexcept pointer-steal moves"s << endl;
+    static_assert(is_nothrow_move_constructible_v<SimpleVector<string>>);
+    static_assert(is_nothrow_move_assignable_v<SimpleVector<string>>);
+
+    SimpleVector<X> source;
+    source.PushBack(X(1));
+    const X* data = source.begin();
+    SimpleVector<X> target(move(source));
+    assert(target.begin() == data && source.GetCapacity() == 0 && source.begin() == nullptr);
+
+    SimpleVector<X> other;
+    other.PushBack(X(2));
+    other = move(target);
+    assert(other.begin() == data && other[0].GetX() == 1 && target.IsEmpty());
+    other = move(other);
+    assert(other.GetSize() == 1);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestCopyAssignmentReusesBuffer() {
+    cout << "Test copy assignment reuses capacity"s << endl;
+    SimpleVector<int> front(1000, 1);
+    SimpleVector<int> back(1000, 2);
+    const int* data = back.begin();
+    back = front;
+    assert(back.begin() == data && back == front);
+
+    SimpleVector<string> big(10, "big"s);
+    SimpleVector<string> small(3, "small"s);
+    const string* words = big.begin();
+    big = small;
+    assert(big.begin() == words && big.GetSize() == 3 && big.GetCapacity() == 10 && big[2] == "small"s);
+    small.Append(big.begin(), big.end());
+    big = small;
+    assert(big.begin() == words && big.GetSize() == 6);
+    small = big;
+    assert(small.GetSize() == 6 && small.GetCapacity() == 6);
+    big = big;
+    assert(big.GetSize() == 6);
+
+    SimpleVector<int> copy(front);
+    assert(copy.GetCapacity() == copy.GetSize());
+    cout << "Done!"s << endl << endl;
+}
+
+void TestGeometricResize() {
+    cout << "Test geometric resize and resize for overwrite"s << endl;
+    SimpleVector<char> buffer;
+    size_t reallocations = 0;
+    const char* data = nullptr;
+    for (int i = 0; i < 10000; ++i) {
+        size_t old_size = buffer.GetSize();
+        buffer.ResizeForOverwrite(old_size + 3);
+        memcpy(buffer.begin() + old_size, "abc", 3);
+        if (buffer.begin() != data) {
+            ++reallocations;
+            data = buffer.begin();
+        }
+    }
+    assert(buffer.GetSize() == 30000 && buffer[29999] == 'c');
+    assert(reallocations < 20);
+
+    SimpleVector<int> ints(Reserve(100));
+    ints.Resize(50);
+    assert(ints.GetCapacity() == 100 && ints[49] == 0);
+    ints.Resize(101);
+    assert(ints.GetCapacity() == 200 && ints[100] == 0);
+
+    SimpleVector<string> words(2, "w"s);
+    words.ResizeForOverwrite(4);
+    assert(words[3].empty() && words.GetCapacity() == 4);
+    words.ResizeForOverwrite(1);
+    assert(words.GetSize() == 1 && words[0] == "w"s);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestHugePageStorage() {
+    cout << "Test huge page mmap storage"s << endl;
+    using Alloc = HugePageAllocator<float, 1 << 16>;
+    SimpleVector<float, Alloc, GrowByPages<Alloc::kHugePageSize, 1 << 16>> v(1 << 20);
+    assert(reinterpret_cast<uintptr_t>(v.begin()) % Alloc::kHugePageSize == 0);
+    assert(all_of(v.begin(), v.end(), [](float x) { return x == 0.0f; }));
+    for (int i = 0; i < (1 << 19); ++i) {
+        v.PushBack(float(i));
+    }
+    assert(v[(1 << 20) + 12345] == 12345.0f && v[100] == 0.0f);
+    v.Resize(100);
+    v.ShrinkToFit();
+    assert(v.GetCapacity() == 100 && v[99] == 0.0f);
+    v.Resize(1 << 20);
+    assert(v[(1 << 20) - 1] == 0.0f);
+
+    //Рост, которому некуда продолжиться на месте, переносит страницы на новую границу huge-страницы
+    Alloc alloc;
+    const size_t count = Alloc::kHugePageSize / sizeof(float);
+    float* block = alloc.allocate(count);
+    block[count - 1] = 7.0f;
+    int obstacle_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_FIXED_NOREPLACE
+    obstacle_flags |= MAP_FIXED_NOREPLACE;
+#endif
+    void* obstacle = mmap(block + count, 4096, PROT_READ, obstacle_flags, -1, 0);
+    float* grown = alloc.reallocate(block, count, 3 * count);
+    assert(reinterpret_cast<uintptr_t>(grown) % Alloc::kHugePageSize == 0 && grown[count - 1] == 7.0f);
+    if (obstacle != MAP_FAILED) {
+        munmap(obstacle, 4096);
+    }
+    alloc.deallocate(grown, 3 * count);
+    try {
+        [[maybe_unused]] float* huge = alloc.allocate(numeric_limits<size_t>::max() / 2);
+        assert(false);
+    } catch (const bad_array_new_length&) {
+    }
+
+    SimpleVector<int> zeroed(1000);
+    assert(all_of(zeroed.begin(), zeroed.end(), [](int x) { return x == 0; }));
+    cout << "Done!"s << endl << endl;
+}
+
+struct Record {
+    int id;
+    double score;
+};
+
+void TestMappedSimpleVector() {
+    cout << "Test file-backed mapped vector"s << endl;
+    const string path = (filesystem::temp_directory_path() / "simple_vector_mapped_test.bin"s).string();
+    {
+        MappedSimpleVector<Record> records(path, MapMode::Create);
+        for (int i = 0; i < 10000; ++i) {
+            records.PushBack({i, i * 0.5});
+        }
+        records.Flush();
+    }
+    assert(filesystem::file_size(path) == 64 + 10000 * sizeof(Record));
+    {
+        const MappedSimpleVector<Record> records(path, MapMode::ReadOnly);
+        assert(records.GetSize() == 10000 && records[9999].id == 9999 && records[4].score == 2.0);
+    }
+    {
+        MappedSimpleVector<Record> records(path, MapMode::ReadWrite);
+        records.PushBack(records[0]);
+        records.Resize(10002);
+        records[0].id = -1;
+        assert(records[10000].id == 0 && records[10001].id == 0);
+    }
+    {
+        MappedSimpleVector<Record> records(path, MapMode::ReadOnly);
+        assert(records.GetSize() == 10002 && records[0].id == -1);
+        bool thrown = false;
+        try {
+            records.PushBack({});
+        } catch (const logic_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            MappedSimpleVector<char> wrong_type(path, MapMode::ReadOnly);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    filesystem::remove(path);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSerialization() {
+    cout << "Test binary serialization"s << endl;
+    const string path = (filesystem::temp_directory_path() / "simple_vector_serialized.bin"s).string();
+    SimpleVector<Record> records;
+    for (int i = 0; i < 1000; ++i) {
+        records.PushBack({i, i * 0.25});
+    }
+    {
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        WriteTo(fd, records);
+        WriteTo(fd, SimpleVector<Record>{});
+        close(fd);
+    }
+    assert(filesystem::file_size(path) == 2 * sizeof(SerializedHeader) + 1000 * sizeof(Record));
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        SimpleVector<Record> loaded(3);
+        ReadFrom(fd, loaded);
+        assert(loaded.GetSize() == 1000 && loaded[999].id == 999 && loaded[4].score == 1.0);
+        ReadFrom(fd, loaded);
+        assert(loaded.IsEmpty());
+        close(fd);
+    }
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        ChunkedReader<Record> reader(fd);
+        assert(reader.GetTotal() == 1000);
+        SimpleVector<Record> chunk;
+        int expected = 0;
+        size_t chunks = 0;
+        while (reader.Next(chunk, 300)) {
+            for (const Record& record : chunk) {
+                assert(record.id == expected++);
+            }
+            ++chunks;
+        }
+        assert(chunks == 4 && expected == 1000 && reader.GetRemaining() == 0);
+        close(fd);
+    }
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        SimpleVector<int> wrong_type;
+        bool thrown = false;
+        try {
+            ReadFrom(fd, wrong_type);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        close(fd);
+    }
+    stringstream stream;
+    SimpleVector<int> ints{1, 2, 3};
+    WriteTo(stream, ints);
+    SimpleVector<int> copy;
+    ReadFrom(stream, copy);
+    assert(copy == ints);
+    stringstream truncated(stream.str().substr(0, sizeof(SerializedHeader) + 4));
+    bool thrown = false;
+    try {
+        ReadFrom(truncated, copy);
+    } catch (const runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && copy == ints);
+
+    //Испорченный заголовок: размер не помещается в память или больше данных в источнике.
+    //Память под него не выделяется, прежнее содержимое вектора сохраняется
+    const string bytes = stream.str();
+    for (uint64_t bad_count : {uint64_t(1) << 62, uint64_t(4)}) {
+        string corrupted = bytes;
+        memcpy(corrupted.data() + offsetof(SerializedHeader, count), &bad_count, sizeof(bad_count));
+        stringstream corrupted_stream(corrupted);
+        thrown = false;
+        try {
+            ReadFrom(corrupted_stream, copy);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && copy == ints);
+
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        assert(write(fd, corrupted.data(), corrupted.size()) == static_cast<ssize_t>(corrupted.size()));
+        close(fd);
+        fd = open(path.c_str(), O_RDONLY);
+        thrown = false;
+        try {
+            ReadFrom(fd, copy);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && copy == ints);
+        lseek(fd, 0, SEEK_SET);
+        thrown = false;
+        try {
+            ChunkedReader<int> reader(fd);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        close(fd);
+
+        //Из канала длину заранее не узнать: обрыв обнаруживается при чтении
+        if (bad_count == 4) {
+            int pipe_fds[2];
+            assert(pipe(pipe_fds) == 0);
+            assert(write(pipe_fds[1], corrupted.data(), corrupted.size()) == static_cast<ssize_t>(corrupted.size()));
+            close(pipe_fds[1]);
+            thrown = false;
+            try {
+                ReadFrom(pipe_fds[0], copy);
+            } catch (const runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown && copy == ints);
+            close(pipe_fds[0]);
+        }
+    }
+    {
+        int pipe_fds[2];
+        assert(pipe(pipe_fds) == 0);
+        string short_data = bytes.substr(0, bytes.size() - 2);
+        assert(write(pipe_fds[1], short_data.data(), short_data.size()) == static_cast<ssize_t>(short_data.size()));
+        close(pipe_fds[1]);
+        ChunkedReader<int> reader(pipe_fds[0]);
+        SimpleVector<int> chunk{7, 7, 7, 7};
+        thrown = false;
+        try {
+            reader.Next(chunk, 10);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && chunk.IsEmpty());
+        close(pipe_fds[0]);
+    }
+    filesystem::remove(path);
+    cout << "Done!"s << endl << endl;
+}
+
+template <typename T>
+void CheckKernelsAgainstStd(mt19937& random) {
+    uniform_int_distribution<int> value(0, 3);
+    for (size_t size = 0; size < 300; size += 1 + size / 8) {
+        SimpleVector<T> lhs(size);
+        for (T& item : lhs) {
+            item = static_cast<T>(value(random));
+        }
+        for (size_t change = 0; change <= size; change += 1 + size / 5) {
+            SimpleVector<T> rhs = lhs;
+            if (change < size) {
+                rhs[change] = static_cast<T>(rhs[change] + 1);
+            }
+            assert(simd::Mismatch(lhs.begin(), rhs.begin(), size)
+                   == static_cast<size_t>(mismatch(lhs.begin(), lhs.end(), rhs.begin()).first - lhs.begin()));
+            assert((lhs == rhs) == equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+            assert((lhs < rhs) == lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+            assert((rhs < lhs) == lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end()));
+        }
+        for (int needle = 0; needle <= 4; ++needle) {
+            const T target = static_cast<T>(needle);
+            assert(lhs.Find(target) == find(lhs.begin(), lhs.end(), target));
+            assert(lhs.Count(target) == static_cast<size_t>(count(lhs.begin(), lhs.end(), target)));
+            assert(lhs.Contains(target) == (find(lhs.begin(), lhs.end(), target) != lhs.end()));
+        }
+    }
+}
+
+template <typename T>
+void CheckFloatingSpecialValues() {
+    const T nan = numeric_limits<T>::quiet_NaN();
+    SimpleVector<T> with_nan(100, T(1));
+    with_nan[70] = nan;
+    assert(!(with_nan == with_nan) && with_nan.Find(nan) == with_nan.end() && with_nan.Count(nan) == 0);
+    SimpleVector<T> bigger = with_nan;
+    bigger[90] = T(2);
+    assert(with_nan < bigger && !(bigger < with_nan));
+    SimpleVector<T> zeros(40, T(0));
+    SimpleVector<T> negative_zeros(40, -T(0));
+    assert(zeros == negative_zeros && negative_zeros.Count(T(0)) == 40);
+}
+
+void TestSimdKernels() {
+    cout << "Test SIMD comparison and search kernels"s << endl;
+    const simd::Level supported = simd::GetSupportedLevel();
+    for (simd::Level level : {simd::Level::Scalar, simd::Level::Sse2, simd::Level::Avx2, simd::Level::Avx512}) {
+        if (level > supported) {
+            break;
+        }
+        assert(simd::SetLevel(level) == level);
+        mt19937 random(42);
+        CheckKernelsAgainstStd<char>(random);
+        CheckKernelsAgainstStd<signed char>(random);
+        CheckKernelsAgainstStd<uint16_t>(random);
+        CheckKernelsAgainstStd<int>(random);
+        CheckKernelsAgainstStd<int64_t>(random);
+        CheckKernelsAgainstStd<float>(random);
+        CheckKernelsAgainstStd<double>(random);
+        CheckFloatingSpecialValues<float>();
+        CheckFloatingSpecialValues<double>();
+    }
+    simd::SetLevel(supported);
+
+    const SimpleVector<int> small{1, 2, 3};
+    const SimpleVector<int> large{1, 2, 4};
+    assert(small < large && large > small && small <= large && large >= small && small != large);
+    assert(!(small > large) && !(large < small) && small <= small && small >= small);
+    const SimpleVector<string> words{"a"s, "b"s};
+    assert(words.Contains("b"s) && !words.Contains("c"s) && words.Find("b"s) == words.begin() + 1);
+    assert(words < SimpleVector<string>{"b"s} && SimpleVector<string>{"b"s} > words);
+    cout << "Done!"s << endl << endl;
+}
+
+// Копирование бросает, когда значение совпадает с poison
+class PoisonOnCopy {
+public:
+    explicit PoisonOnCopy(int value)
+        : value_(value) {
+        ++alive;
+    }
+    PoisonOnCopy(const PoisonOnCopy& other)
+        : value_(other.value_) {
+        if (value_ == poison) {
+            throw runtime_error("poisoned copy");
+        }
+        ++alive;
+    }
+    PoisonOnCopy& operator=(const PoisonOnCopy&) = default;
+    ~PoisonOnCopy() {
+        --alive;
+    }
+    int GetValue() const {
+        return value_;
+    }
+
+    inline static atomic<int> alive = 0;
+    inline static int poison = -1;
+
+private:
+    int value_;
+};
+
+void TestParallelFill() {
+    cout << "Test parallel fill and copy"s << endl;
+    const ParallelPolicy policy{4, 1};
+    const size_t size = 100000;
+    {
+        SimpleVector<int> ints(size, 7, policy);
+        assert(ints.GetSize() == size && ints.Count(7) == size);
+        SimpleVector<int> copy(ints, policy);
+        assert(copy == ints);
+        copy.Resize(3 * size, policy);
+        assert(copy.GetSize() == 3 * size && copy.Count(0) == 2 * size && copy[size - 1] == 7);
+        copy.Reserve(10 * size, policy);
+        assert(copy.GetCapacity() == 10 * size && copy.Count(7) == size);
+    }
+    {
+        SimpleVector<string> words(size / 10, "parallel"s, policy);
+        words.Reserve(size, policy);
+        assert(words.GetCapacity() == size && words[size / 10 - 1] == "parallel"s);
+        SimpleVector<string> copy(words, policy);
+        assert(copy == words);
+    }
+    {
+        SimpleVector<PoisonOnCopy> values(size / 10, PoisonOnCopy(1), policy);
+        values[size / 20] = PoisonOnCopy(2);
+        PoisonOnCopy::poison = 2;
+        bool thrown = false;
+        try {
+            SimpleVector<PoisonOnCopy> copy(values, policy);
+        } catch (const runtime_error&) {
+            thrown = true;
+        }
+        PoisonOnCopy::poison = -1;
+        assert(thrown && PoisonOnCopy::alive == static_cast<int>(size / 10));
+    }
+    assert(PoisonOnCopy::alive == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+atomic<size_t> counted_elements{0};
+
+//Потокобезопасный аллокатор, считающий живые элементы.
+//Медленное выделение расширяет окно, в котором писатели гонятся за новым сегментом
+template <typename Type>
+struct CountingAllocator {
+    using value_type = Type;
+
+    CountingAllocator() = default;
+
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        counted_elements += n;
+        this_thread::sleep_for(chrono::milliseconds(1));
+        return allocator<Type>().allocate(n);
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        counted_elements -= n;
+        allocator<Type>().deallocate(ptr, n);
+    }
+
+    bool operator==(const CountingAllocator&) const noexcept {
+        return true;
+    }
+
+    bool operator!=(const CountingAllocator&) const noexcept {
+        return false;
+    }
+};
+
+void TestConcurrentSimpleVector() {
+    cout << "Test concurrent append"s << endl;
+    const int threads = 4;
+    const int per_thread = 20000;
+    ConcurrentSimpleVector<int, 16> values;
+    values.PushBack(-1);
+    const int* first = &values[0];
+
+    atomic<bool> done = false;
+    thread reader([&] {
+        //Готовые элементы не переезжают и не меняются, пока пишущие потоки растят вектор
+        while (!done.load()) {
+            values.ForEachReady([&](size_t index, int value) {
+                assert(index != 0 || value == -1);
+                assert(value == -1 || (value >= 0 && value < threads * per_thread));
+            });
+            assert(&values[0] == first);
+        }
+    });
+    vector<thread> writers;
+    for (int t = 0; t < threads; ++t) {
+        writers.emplace_back([&values, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                size_t index = values.PushBack(t * per_thread + i);
+                assert(values.IsReady(index) && values[index] == t * per_thread + i);
+            }
+        });
+    }
+    for (thread& writer : writers) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    assert(values.GetSize() == threads * per_thread + 1 && &values[0] == first);
+    vector<int> seen(threads * per_thread, 0);
+    for (size_t index = 1; index < values.GetSize(); ++index) {
+        ++seen[values.At(index)];
+    }
+    assert(count(seen.begin(), seen.end(), 1) == threads * per_thread);
+    assert(!values.IsReady(values.GetSize()));
+
+    ConcurrentSimpleVector<PoisonOnCopy> guarded;
+    guarded.Reserve(100);
+    PoisonOnCopy::poison = 3;
+    guarded.PushBack(PoisonOnCopy(1));
+    bool thrown = false;
+    try {
+        guarded.PushBack(PoisonOnCopy(3));
+    } catch (const runtime_error&) {
+        thrown = true;
+    }
+    PoisonOnCopy::poison = -1;
+    guarded.EmplaceBack(4);
+    assert(thrown && guarded.GetSize() == 3 && guarded.IsReady(0) && !guarded.IsReady(1) && guarded.At(2).GetValue() == 4);
+
+    //Первый слот сегмента выделяет следующий сегмент наперёд
+    counted_elements = 0;
+    {
+        ConcurrentSimpleVector<int, 16, CountingAllocator<int>> ahead;
+        ahead.PushBack(0);
+        assert(counted_elements == 16 + 32);
+        for (int i = 1; i < 16; ++i) {
+            ahead.PushBack(i);
+        }
+        assert(counted_elements == 16 + 32);
+        ahead.PushBack(16);
+        assert(counted_elements == 16 + 32 + 64);
+    }
+    assert(counted_elements == 0);
+
+    //Копии проигравших гонку за сегмент освобождаются
+    {
+        ConcurrentSimpleVector<int, 16, CountingAllocator<int>> raced;
+        atomic<bool> go = false;
+        const int racers = 8;
+        const int per_racer = 5000;
+        vector<thread> racer_threads;
+        for (int t = 0; t < racers; ++t) {
+            racer_threads.emplace_back([&] {
+                while (!go.load()) {
+                }
+                for (int i = 0; i < per_racer; ++i) {
+                    raced.PushBack(i);
+                }
+            });
+        }
+        go = true;
+        for (thread& racer : racer_threads) {
+            racer.join();
+        }
+        size_t expected = 0;
+        size_t segment_size = 16;
+        for (; expected < racers * per_racer; segment_size *= 2) {
+            expected += segment_size;
+        }
+        assert(raced.GetSize() == racers * per_racer && counted_elements == expected + segment_size);
+    }
+    assert(counted_elements == 0);
+    cout << "Done!"s << endl << endl;
+}
+
+template <typename T, typename Make>
+void CheckGapVectorAgainstVector(Make make) {
+    mt19937 random(7);
+    GapVector<T> gap;
+    vector<T> expected;
+    for (int step = 0; step < 3000; ++step) {
+        size_t size = expected.size();
+        switch (random() % 6) {
+        case 0:
+        case 1: {
+            T value = make(step);
+            gap.InsertAtCursor(value);
+            expected.insert(expected.begin() + gap.GetCursor() - 1, value);
+            break;
+        }
+        case 2:
+            gap.SetCursor(random() % (size + 1));
+            break;
+        case 3:
+            if (gap.GetCursor() > 0) {
+                expected.erase(expected.begin() + gap.GetCursor() - 1);
+                gap.EraseBeforeCursor();
+            }
+            break;
+        case 4:
+            if (size > 0) {
+                size_t index = random() % size;
+                gap.Erase(gap.cbegin() + index);
+                expected.erase(expected.begin() + index);
+            }
+            break;
+        case 5: {
+            size_t index = random() % (size + 1);
+            gap.Insert(gap.cbegin() + index, make(step));
+            expected.insert(expected.begin() + index, make(step));
+            break;
+        }
+        }
+        assert(gap.GetSize() == expected.size() && equal(gap.begin(), gap.end(), expected.begin(), expected.end()));
+    }
+    GapVector<T> copy = gap;
+    assert(copy == gap && copy.GetCursor() == gap.GetCursor());
+    T* data = gap.Compact();
+    assert(gap.GetCursor() == gap.GetSize() && equal(data, data + gap.GetSize(), expected.begin()));
+}
+
+void TestGapVector() {
+    cout << "Test gap buffer editing"s << endl;
+    CheckGapVectorAgainstVector<int>([](int step) { return step; });
+    CheckGapVectorAgainstVector<string>([](int step) { return to_string(step) + "-long-enough-for-heap"s; });
+
+    GapVector<char> text{'h', 'l', 'o'};
+    text.SetCursor(1);
+    text.InsertAtCursor('e');
+    text.InsertAtCursor('l');
+    text.SetCursor(text.GetSize());
+    text.InsertAtCursor('!');
+    text.EraseBeforeCursor();
+    text.PushBack('?');
+    text.PopBack();
+    assert(string(text.Compact(), text.GetSize()) == "hello"s);
+
+    GapVector<int> numbers{5, 3, 1, 4, 2};
+    numbers.SetCursor(2);
+    sort(numbers.begin(), numbers.end());
+    assert((numbers == GapVector<int>{1, 2, 3, 4, 5}) && numbers.At(4) == 5);
+    //Вставка значения, которое лежит в самом векторе, при росте буфера
+    numbers.InsertAtCursor(numbers[0]);
+    assert(numbers[2] == 1 && numbers.GetSize() == 6);
+
+    GapVector<X> movable;
+    movable.PushBack(X(1));
+    movable.Insert(movable.cbegin(), X(2));
+    movable.SetCursor(2);
+    assert(movable[0].GetX() == 2 && movable[1].GetX() == 1);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestBatchErase() {
+    cout << "Test range erase, EraseIf and SwapErase"s << endl;
+    {
+        SimpleVector<int> numbers(10);
+        iota(numbers.begin(), numbers.end(), 0);
+        auto it = numbers.Erase(numbers.cbegin() + 2, numbers.cbegin() + 5);
+        assert(*it == 5 && (numbers == SimpleVector<int>{0, 1, 5, 6, 7, 8, 9}));
+        assert(numbers.Erase(numbers.cbegin() + 1, numbers.cbegin() + 1) == numbers.begin() + 1);
+        assert(numbers.Erase(numbers.cbegin() + 4, numbers.cend()) == numbers.end() && numbers.GetSize() == 4);
+        assert(numbers.EraseIf([](int value) { return value % 2 == 1; }) == 2);
+        assert((numbers == SimpleVector<int>{0, 6}) && numbers.GetCapacity() == 10);
+    }
+    {
+        SimpleVector<Counted> rows;
+        for (int i = 0; i < 100; ++i) {
+            rows.EmplaceBack(i);
+        }
+        rows.Erase(rows.cbegin() + 10, rows.cbegin() + 30);
+        assert(Counted::alive == 80 && rows[10].GetValue() == 30);
+        assert(rows.EraseIf([](const Counted& row) { return row.GetValue() % 3 == 0; }) == 28);
+        assert(Counted::alive == 52 && rows.GetSize() == 52);
+        assert(rows.SwapErase(rows.cbegin())->GetValue() == 98 && rows.GetSize() == 51);
+        assert(rows.SwapErase(rows.cend() - 1) == rows.end() && Counted::alive == 50);
+    }
+    assert(Counted::alive == 0);
+    {
+        SimpleVector<Handle> handles;
+        for (int i = 0; i < 8; ++i) {
+            handles.EmplaceBack(i);
+        }
+        handles.Erase(handles.cbegin(), handles.cbegin() + 3);
+        assert(handles.GetSize() == 5 && handles[0].GetValue() == 3);
+    }
+    {
+        SimpleVector<string> words{"a"s, "b"s, "c"s};
+        words.SwapErase(words.cbegin());
+        assert((words == SimpleVector<string>{"c"s, "b"s}));
+    }
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSoaVector() {
+    cout << "Test structure-of-arrays vector"s << endl;
+    SoaVector<float, float, string> points;
+    points.Reserve(4);
+    assert(points.GetCapacity() == 4 && points.IsEmpty());
+    for (int i = 0; i < 10; ++i) {
+        points.PushBack(static_cast<float>(i), static_cast<float>(i * 2), "p"s + to_string(i));
+    }
+    points.EmplaceBack(10.f, 20.f, "zzz");
+    assert(points.GetSize() == 11 && points[10].Get<2>() == "zzz"s);
+
+    auto [x, y, name] = points[3];
+    assert(x == 3.f && y == 6.f && name == "p3"s);
+    x = -1.f;
+    assert(points.Column<0>()[3] == -1.f);
+    points[4] = make_tuple(40.f, 80.f, "four"s);
+    assert((points.At(4).ToTuple() == make_tuple(40.f, 80.f, "four"s)));
+
+    float sum = 0;
+    for (float value : points.Column<1>()) {
+        sum += value;
+    }
+    assert(sum == 2 * (45 + 10) + 80 - 8);
+
+    points.Erase(0);
+    assert(points.GetSize() == 10 && points[0].Get<2>() == "p1"s && points.Column<1>().GetSize() == 10);
+    points.SwapErase(0);
+    assert(points[0].Get<2>() == "zzz"s && points.GetSize() == 9);
+    points.PopBack();
+    assert(points.GetSize() == 8 && points.Column<2>().GetSize() == 8);
+
+    const auto& view = points;
+    typename SoaVector<float, float, string>::ConstRow row = view[2];
+    assert(row.Get<0>() == -1.f);
+
+    SoaVector<int, PoisonOnCopy> guarded;
+    guarded.PushBack(1, PoisonOnCopy(1));
+    PoisonOnCopy::poison = 2;
+    bool thrown = false;
+    try {
+        PoisonOnCopy poisoned(2);
+        guarded.EmplaceBack(2, poisoned);
+    } catch (const runtime_error&) {
+        thrown = true;
+    }
+    PoisonOnCopy::poison = -1;
+    assert(thrown && guarded.GetSize() == 1 && guarded.Column<0>().GetSize() == 1);
+    points.Clear();
+    assert(points.IsEmpty());
+    cout << "Done!"s << endl << endl;
+}
+
+void TestVectorStats() {
+    cout << "Test allocation statistics"s << endl;
+#if SIMPLE_VECTOR_STATS
+    static StatsTag tag("test-stats"s);
+    {
+        SimpleVector<int> numbers;
+        numbers.SetStatsTag(tag);
+        for (int i = 0; i < 9; ++i) {
+            numbers.PushBack(i);
+        }
+        //Вместимость 1, 2, 4, 8, 16: одно выделение и четыре перевыделения
+        VectorStats stats = numbers.GetStats();
+        assert(stats.allocations == 1 && stats.reallocations == 4);
+        assert(stats.elements_moved == 1 + 2 + 4 + 8 && stats.bytes_moved == 15 * sizeof(int));
+        assert(stats.peak_capacity == 16 && stats.slack == 7);
+
+        SimpleVector<string> words;
+        words.SetStatsTag(tag);
+        words.Reserve(2);
+        words.PushBack("a"s);
+        words.PushBack("b"s);
+        words.Insert(words.cbegin(), "c"s);
+        words.ShrinkToFit();
+        stats = words.GetStats();
+        assert(stats.allocations == 1 && stats.reallocations == 2 && stats.elements_moved == 2 + 3);
+        assert(stats.peak_capacity == 4 && stats.slack == 0);
+
+        SimpleVector<string> empty;
+        empty.SetStatsTag(tag);
+    }
+    VectorStats total = tag.GetStats();
+    assert(total.allocations == 2 && total.reallocations == 6 && total.elements_moved == 20);
+    assert(total.peak_capacity == 16 && total.slack == 7 && total.instances == 2);
+
+    SimpleVector<int> copy(SimpleVector<int>(5, 1));
+    assert(copy.GetStats().allocations == 1 && copy.GetStats().reallocations == 0);
+    assert(DefaultStatsTag<int>().GetStats().allocations >= 2);
+
+    //Счётчики и метка переходят вместе с буфером при перемещении и обмене
+    static StatsTag moved_tag("test-stats-moved"s);
+    {
+        SimpleVector<int> source;
+        source.SetStatsTag(moved_tag);
+        source.Reserve(8);
+        source.PushBack(1);
+        SimpleVector<int> target(move(source));
+        assert(target.GetStats().allocations == 1 && target.GetStats().peak_capacity == 8);
+        assert(source.GetStats().allocations == 0);
+        SimpleVector<int> other(3, 2);
+        other.swap(target);
+        assert(other.GetStats().peak_capacity == 8 && target.GetStats().peak_capacity == 3);
+        SimpleVector<int> assigned;
+        assigned = move(other);
+        assert(assigned.GetStats().peak_capacity == 8 && other.GetStats().allocations == 0);
+    }
+    //Буфер на 8 элементов учтён в своей метке один раз, с семью незанятыми местами
+    total = moved_tag.GetStats();
+    assert(total.allocations == 1 && total.instances == 1 && total.slack == 7);
+
+    ostringstream dump;
+    StatsRegistry::Dump(dump);
+    assert(dump.str().find("\"tag\": \"test-stats\", \"allocations\": 2"s) != string::npos);
+    assert(dump.str().find("SimpleVector<int>"s) != string::npos);
+    //Имя метки попадает в JSON экранированным
+    static StatsTag quoted("say \"hi\"\\\n\x01"s);
+    {
+        SimpleVector<int> numbers;
+        numbers.SetStatsTag(quoted);
+        numbers.PushBack(1);
+    }
+    ostringstream quoted_dump;
+    StatsRegistry::Dump(quoted_dump);
+    assert(quoted_dump.str().find("\"tag\": \"say \\\"hi\\\"\\\\\\n\\u0001\", \"allocations\": 1"s) != string::npos);
+    assert(DefaultStatsTag<int>().GetName() == "SimpleVector<int>"s);
+    size_t tags = 0;
+    StatsRegistry::ForEach([&tags](const StatsTag&) { ++tags; });
+    assert(tags >= 2);
+    StatsRegistry::Reset();
+    assert(tag.GetStats().allocations == 0 && tag.GetStats().instances == 0);
+#else
+    //Выключенный учёт не добавляет полей
+    static_assert(sizeof(SimpleVector<int>) == 2 * sizeof(size_t) + sizeof(ArrayPtr<int, MallocAllocator<int>>));
+    SimpleVector<int> numbers(10, 1);
+    numbers.PushBack(2);
+    VectorStats stats = numbers.GetStats();
+    assert(stats.allocations == 0 && stats.reallocations == 0 && stats.peak_capacity == 0 && stats.slack == 0);
+#endif
+    cout << "Done!"s << endl << endl;
+}
+
+void TestAlignedStorage() {
+    cout << "Test aligned storage"s << endl;
+    auto is_aligned = [](const void* ptr, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+    };
+    using FloatVector = SimpleVector<float, AlignedAllocator<float, 64>>;
+    static_assert(FloatVector::kDataAlignment == 64 && SimpleVector<double>::kDataAlignment == alignof(double));
+    FloatVector values;
+    for (int i = 0; i < 1000; ++i) {
+        values.PushBack(static_cast<float>(i));
+        assert(is_aligned(values.AlignedData(), 64));
+    }
+    values.Reserve(100000);
+    assert(is_aligned(values.AlignedData(), 64) && values[999] == 999.f);
+    values.ShrinkToFit();
+    assert(is_aligned(values.AlignedData(), 64) && values.GetCapacity() == 1000);
+    values.Insert(values.cbegin(), -1.f);
+    values.Resize(3000);
+    FloatVector copy(values);
+    assert(is_aligned(values.AlignedData(), 64) && is_aligned(copy.AlignedData(), 64));
+    assert(copy == values && copy[0] == -1.f && copy[2999] == 0.f);
+    float sum = 0;
+    const float* data = copy.AlignedData();
+    for (size_t i = 0; i < copy.GetSize(); ++i) {
+        sum += data[i];
+    }
+    assert(sum == 999.f * 1000.f / 2.f - 1.f);
+
+    SimpleVector<int, AlignedAllocator<int, 128>> zeroed(33);
+    assert(is_aligned(zeroed.AlignedData(), 128) && zeroed[32] == 0);
+
+    SimpleVector<string, AlignedAllocator<string, 64>> words{"a"s, "b"s};
+    for (int i = 0; i < 40; ++i) {
+        words.PushBack(to_string(i));
+        assert(is_aligned(words.AlignedData(), 64));
+    }
+    assert(words[41] == "39"s);
+
+    //Счётчики потоков лежат каждый на своей строке кэша
+    static_assert(sizeof(CacheLinePadded<long>) == kCacheLineSize && alignof(CacheLinePadded<long>) == kCacheLineSize);
+    static_assert(IsTriviallyRelocatable<CacheLinePadded<long>>::value);
+    SimpleVector<CacheLinePadded<long>> counters(4, 0L);
+    counters.PushBack(7L);
+    assert(is_aligned(&counters[1], kCacheLineSize) && &counters[1].Get() - &counters[0].Get() == 8);
+    vector<thread> workers;
+    for (size_t t = 0; t < counters.GetSize(); ++t) {
+        workers.emplace_back([&counters, t] {
+            for (int i = 0; i < 10000; ++i) {
+                ++counters[t].value;
+            }
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    assert(counters[0].Get() == 10000 && counters[4].Get() == 10007);
+    SimpleVector<CacheLinePadded<string, 128>, AlignedAllocator<CacheLinePadded<string, 128>, 128>> names(2, "x"s);
+    names.EmplaceBack("y"s);
+    assert(is_aligned(&names[2], 128) && names[2].Get() == "y"s);
+
+    //Размер с округлением до выравнивания тоже проверяется на переполнение
+    try {
+        values.Reserve(numeric_limits<size_t>::max() / sizeof(float) - 1);
+        assert(false);
+    } catch (const bad_array_new_length&) {
+    }
+    assert(is_aligned(values.AlignedData(), 64) && values.GetSize() == 3000 && values[0] == -1.f);
+    cout << "Done!"s << endl << endl;
+}
+
+void TestSharedSimpleVector() {
+    cout << "Test copy-on-write vector"s << endl;
+    SharedSimpleVector<string> config{"a"s, "b"s, "c"s};
+    const string* buffer = config.cbegin();
+    SharedSimpleVector<string> copy = config;
+    assert(copy.cbegin() == buffer && config.GetUseCount() == 2 && copy.IsShared());
+    assert(copy == config && as_const(copy)[1] == "b"s);
+
+    //Первое изменение отделяет копию, оригинал не меняется
+    copy.PushBack("d"s);
+    assert(copy.cbegin() != buffer && config.cbegin() == buffer);
+    assert(!config.IsShared() && !copy.IsShared() && config.GetSize() == 3 && copy.GetSize() == 4);
+    SharedSimpleVector<string> other = config;
+    other[0] = "z"s;
+    assert(config[0] == "a"s && other[0] == "z"s);
+
+    //Аргумент может ссылаться на разделённый буфер, который отпускается во время вставки
+    SharedSimpleVector<string> alias = config;
+    alias.Insert(alias.cbegin() + 1, as_const(alias)[2]);
+    alias.Erase(alias.cbegin());
+    assert((alias.Mutable() == SimpleVector<string>{"c"s, "b"s, "c"s}));
+    alias.Erase(alias.cbegin(), alias.cbegin() + 2);
+    assert(alias.GetSize() == 1 && config.GetSize() == 3);
+
+    //Единственный владелец меняет буфер на месте
+    SimpleVector<int> source(1000, 7);
+    const int* data = source.begin();
+    SharedSimpleVector<int> numbers(move(source));
+    assert(numbers.cbegin() == data);
+    numbers[0] = 1;
+    numbers.PopBack();
+    assert(numbers.cbegin() == data && numbers.GetSize() == 999 && numbers[0] == 1);
+
+    //Снимок читают многие потоки, пока владелец продолжает писать в свою копию
+    FrozenSimpleVector<int> frozen = numbers.Freeze();
+    assert(frozen.begin() == data && numbers.IsShared());
+    atomic<long> total{0};
+    vector<thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([snapshot = frozen, &total] {
+            total += accumulate(snapshot.begin(), snapshot.end(), 0L);
+        });
+    }
+    for (int i = 0; i < 100; ++i) {
+        numbers.PushBack(i);
+    }
+    for (thread& reader : readers) {
+        reader.join();
+    }
+    assert(total == 4 * (1 + 998 * 7) && frozen.GetSize() == 999 && numbers.GetSize() == 1099);
+    assert(frozen.At(0) == 1 && frozen.Contains(7) && !frozen.Contains(99));
+
+    SharedSimpleVector<int> thawed(frozen);
+    assert(thawed.cbegin() == data && frozen.Get().GetSize() == 999);
+    thawed.Clear();
+    assert(thawed.IsEmpty() && frozen.GetSize() == 999);
+    thawed.PushBack(5);
+    assert(thawed.GetSize() == 1 && thawed.At(0) == 5);
+
+    SharedSimpleVector<int> empty;
+    assert(empty.IsEmpty() && empty.GetUseCount() == 0 && empty.Freeze().IsEmpty());
+    empty.EmplaceBack(3);
+    assert(empty[0] == 3);
+    cout << "Done!"s << endl << endl;
+}
+
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+constexpr SimpleVector<uint32_t> BuildCrcTable() {
+    SimpleVector<uint32_t> table;
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0);
+        }
+        table.PushBack(crc);
+    }
+    return table;
+}
+
+constexpr bool EditAtCompileTime() {
+    SimpleVector<int> numbers{1, 2, 3};
+    numbers.Insert(numbers.cbegin() + 1, 10);
+    numbers.Insert(numbers.cbegin(), {7, 8});
+    numbers.Erase(numbers.cbegin() + 2);
+    numbers.Erase(numbers.cbegin(), numbers.cbegin() + 1);
+    numbers.Resize(6);
+    SimpleVector<int> copy = numbers;
+    copy.PopBack();
+    copy.SwapErase(copy.cbegin());
+    int sum = 0;
+    for (int value : copy) {
+        sum += value;
+    }
+    return numbers == SimpleVector<int>{8, 10, 2, 3, 0, 0} && copy == SimpleVector<int>{0, 10, 2, 3}
+        && sum == 15 && copy.Contains(10) && copy.Count(0) == 1 && copy < numbers;
+}
+
+constexpr size_t MoveStringsAtCompileTime() {
+    SimpleVector<string> words;
+    for (int i = 0; i < 20; ++i) {
+        words.EmplaceBack(i % 2 ? "odd" : "even");
+    }
+    words.Insert(words.cbegin() + 3, "inserted"s);
+    words.EraseIf([](const string& word) { return word == "odd"; });
+    SimpleVector<string> moved = move(words);
+    moved.ShrinkToFit();
+    return moved.GetSize() * 100 + moved[3].size();
+}
+#endif
+
+void TestConstexprSimpleVector() {
+    cout << "Test compile-time vectors"s << endl;
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+    static_assert(EditAtCompileTime());
+    static_assert(MoveStringsAtCompileTime() == 11 * 100 + 4);
+    static_assert(BuildCrcTable().GetSize() == 256 && BuildCrcTable()[1] == 0x77073096u);
+
+    static constexpr auto kCrcTable = FreezeToArray([] { return BuildCrcTable(); });
+    static_assert(kCrcTable.size() == 256 && kCrcTable[255] == 0x2D02EF8Du);
+    //Та же функция во время выполнения идёт обычными путями: malloc, realloc, SIMD-сравнение
+    SimpleVector<uint32_t> runtime = BuildCrcTable();
+    assert(equal(runtime.begin(), runtime.end(), kCrcTable.begin(), kCrcTable.end()));
+    assert(EditAtCompileTime() && MoveStringsAtCompileTime() == 1104);
+#endif
+    cout << "Done!"s << endl << endl;
+}
+
+void TestFlatContainers() {
+    cout << "Test flat map and set"s << endl;
+    //Двоичный поиск без ветвлений совпадает с lower_bound на всех размерах и границах
+    for (size_t size = 0; size < 40; ++size) {
+        SimpleVector<int> keys;
+        for (size_t i = 0; i < size; ++i) {
+            keys.PushBack(static_cast<int>(i * 2));
+        }
+        for (int key = -1; key <= static_cast<int>(size * 2); ++key) {
+            size_t expected = lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+            assert(flat_detail::LowerBound(keys.begin(), size, key, less<int>()) == expected);
+        }
+    }
+
+    FlatSet<int> digits{5, 1, 4, 1, 5, 9, 2, 6};
+    assert(digits.GetSize() == 6);
+    assert(is_sorted(digits.begin(), digits.end()));
+    assert(digits.Contains(9) && !digits.Contains(3) && digits.Find(3) == digits.end());
+    auto [pos, inserted] = digits.Insert(3);
+    assert(inserted && *pos == 3 && pos == digits.begin() + 2);
+    assert(!digits.Insert(3).second && digits.GetSize() == 7);
+    assert(digits.Erase(4) == 1 && digits.Erase(4) == 0);
+    assert(*digits.LowerBound(4) == 5);
+
+    FlatSet<string, greater<string>> words({"b"s, "a"s, "c"s, "a"s});
+    assert(words.GetSize() == 3 && *words.begin() == "c"s);
+
+    FlatMap<string, int> counts{{"two"s, 2}, {"one"s, 1}, {"three"s, 3}, {"one"s, 100}};
+    assert(counts.GetSize() == 3 && counts.At("one"s) == 1);
+    assert(counts.GetKeys()[0] == "one"s && counts.GetValues()[0] == 1);
+    counts["four"s] = 4;
+    ++counts["one"s];
+    assert(counts.At("four"s) == 4 && counts.At("one"s) == 2);
+    assert(!counts.Insert("two"s, 20).second && counts.At("two"s) == 2);
+    assert(!counts.InsertOrAssign("two"s, 20).second && counts.At("two"s) == 20);
+    try {
+        counts.At("five"s);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+    auto it = counts.Find("three"s);
+    assert(it != counts.end() && it.GetKey() == "three"s && it.GetValue() == 3);
+    it = counts.Erase(it);
+    assert(it.GetKey() == "two"s && !counts.Contains("three"s));
+    int total = 0;
+    for (auto [key, value] : counts) {
+        total += value;
+        value = 0;
+    }
+    assert(total == 4 + 2 + 20 && counts.At("two"s) == 0);
+    const auto& const_counts = counts;
+    assert(const_counts.Find("one"s) != const_counts.end() && const_counts.At("one"s) == 0);
+    assert(counts.Erase("one"s) == 1 && counts.Erase("one"s) == 0);
+
+    //Случайные операции сверяются с std::digits и std::counts, пачки вставляются слиянием
+    mt19937 generator(42);
+    uniform_int_distribution<int> keys(0, 500);
+    FlatSet<int> flat_set;
+    set<int> reference_set;
+    FlatMap<int, int> flat_map;
+    map<int, int> reference_map;
+    for (int round = 0; round < 200; ++round) {
+        SimpleVector<int> batch;
+        SimpleVector<pair<int, int>> pairs;
+        for (int i = 0; i < 20; ++i) {
+            int key = keys(generator);
+            batch.PushBack(key);
+            pairs.PushBack({key, round * 100 + i});
+        }
+        flat_set.InsertRange(batch.begin(), batch.end());
+        reference_set.insert(batch.begin(), batch.end());
+        flat_map.InsertRange(pairs.begin(), pairs.end());
+        reference_map.insert(pairs.begin(), pairs.end());
+
+        int key = keys(generator);
+        assert(flat_set.Erase(key) == reference_set.erase(key));
+        assert(flat_map.Erase(key) == reference_map.erase(key));
+        key = keys(generator);
+        assert(flat_set.Insert(key).second == reference_set.insert(key).second);
+        assert(flat_map.Insert(key, -round).second == reference_map.insert({key, -round}).second);
+    }
+    assert(equal(flat_set.begin(), flat_set.end(), reference_set.begin(), reference_set.end()));
+    assert(flat_map.GetSize() == reference_map.size());
+    auto reference = reference_map.begin();
+    for (auto [key, value] : flat_map) {
+        assert(key == reference->first && value == reference->second);
+        ++reference;
+    }
+
+    //Аллокаторы колонок передаются в конструкторах и сохраняются при слиянии
+    MonotonicArena arena;
+    {
+        using ArenaMap = FlatMap<int, string, less<int>, ResourceAllocator<int>, ResourceAllocator<string>>;
+        ArenaMap arena_map({{2, "b"s}, {1, "a"s}}, less<int>(), &arena, &arena);
+        const vector<pair<int, string>> batch{{3, "c"s}, {0, "z"s}, {2, "x"s}};
+        arena_map.InsertRange(batch.begin(), batch.end());
+        arena_map.Emplace(5, "e"s);
+        assert(arena_map.GetSize() == 5 && arena_map.At(2) == "b"s && arena_map.At(0) == "z"s);
+        assert(arena_map.GetKeys().GetAllocator().GetResource() == &arena);
+        assert(arena_map.GetValues().GetAllocator().GetResource() == &arena);
+        ArenaMap ranged(batch.begin(), batch.end(), less<int>(), &arena, &arena);
+        assert(ranged.GetKeys().GetAllocator().GetResource() == &arena && ranged.GetKeys()[0] == 0);
+        FlatSet<int, less<int>, ResourceAllocator<int>> arena_set({4, 1}, less<int>(), &arena);
+        const int more[] = {3, 1, 2};
+        arena_set.InsertRange(begin(more), end(more));
+        assert(arena_set.GetSize() == 4 && arena_set.GetKeys().GetAllocator().GetResource() == &arena);
+    }
+    assert(arena.GetReservedBytes() > 0);
+
+    //Несдвигаемые значения: вставка в середину и слияние переносят их перемещением
+    FlatMap<int, unique_ptr<int>> owners;
+    owners.Emplace(2, make_unique<int>(2));
+    owners.Emplace(1, make_unique<int>(1));
+    assert(*owners.At(1) == 1 && *owners.At(2) == 2);
+    cout << "Done!"s << endl << endl;
+}
+
 int main() {
     TestTemporaryObjConstructor();
     TestTemporaryObjOperator();
@@ -159,5 +1727,29 @@ int main() {
     TestNoncopiablePushBack();
     TestNoncopiableInsert();
     TestNoncopiableErase();
+    TestRawStorage();
+    TestResourceAllocators();
+    TestTriviallyRelocatableGrowth();
+    TestSmallSimpleVector();
+    TestEmplace();
+    TestRangeInsert();
+    TestGrowthPolicies();
+    TestMoveIsPointerSteal();
+    TestCopyAssignmentReusesBuffer();
+    TestGeometricResize();
+    TestHugePageStorage();
+    TestMappedSimpleVector();
+    TestSerialization();
+    TestSimdKernels();
+    TestParallelFill();
+    TestConcurrentSimpleVector();
+    TestGapVector();
+    TestBatchErase();
+    TestSoaVector();
+    TestVectorStats();
+    TestAlignedStorage();
+    TestSharedSimpleVector();
+    TestConstexprSimpleVector();
+    TestFlatContainers();
     return 0;
 }
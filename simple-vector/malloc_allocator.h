@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+
+namespace allocator_detail {
+
+//  n   .      size_t,  std::bad_array_new_length,  new[]:
+//         
+template <typename Type>
+size_t CheckedBytes(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(Type)) throw std::bad_array_new_length();
+    return n * sizeof(Type);
+}
+
+//  n ,     alignment:   aligned_alloc
+template <typename Type>
+size_t AlignedBytes(size_t n, size_t alignment) {
+    size_t bytes = CheckedBytes<Type>(n);
+    if (bytes > std::numeric_limits<size_t>::max() - (alignment - 1)) throw std::bad_array_new_length();
+    return (bytes + alignment - 1) / alignment * alignment;
+}
+
+//    alignment.  MSVC  std::aligned_alloc:  _aligned_malloc,
+//       _aligned_free
+inline void* AlignedMalloc(size_t alignment, size_t bytes) noexcept {
+#if defined(_WIN32)
+    return _aligned_malloc(bytes, alignment);
+#else
+    return std::aligned_alloc(alignment, bytes);
+#endif
+}
+
+inline void AlignedFree(void* ptr) noexcept {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace allocator_detail
+
+//   malloc/realloc/free.
+//    std::allocator  reallocate:    
+// SimpleVector   realloc,    glibc   mremap  
+template <typename Type>
+class MallocAllocator {
+public:
+    using value_type = Type;
+
+    MallocAllocator() noexcept = default;
+
+    template <typename Other>
+    MallocAllocator(const MallocAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t n) {
+        void* ptr = nullptr;
+        if constexpr (kOverAligned) {
+            ptr = allocator_detail::AlignedMalloc(alignof(Type), allocator_detail::AlignedBytes<Type>(n, alignof(Type)));
+        }
+        else {
+            ptr = std::malloc(allocator_detail::CheckedBytes<Type>(n));
+        }
+        if (ptr == nullptr) throw std::bad_alloc();
+        return static_cast<Type*>(ptr);
+    }
+
+    //    calloc:       
+    Type* allocate_zeroed(size_t n) {
+        if constexpr (kOverAligned) {
+            Type* ptr = allocate(n);
+            std::memset(static_cast<void*>(ptr), 0, n * sizeof(Type));
+            return ptr;
+        }
+        else {
+            void* ptr = std::calloc(allocator_detail::CheckedBytes<Type>(n), 1);
+            if (ptr == nullptr) throw std::bad_alloc();
+            return static_cast<Type*>(ptr);
+        }
+    }
+
+    void deallocate(Type* ptr, size_t) noexcept {
+        if constexpr (kOverAligned) {
+            allocator_detail::AlignedFree(ptr);
+        }
+        else {
+            std::free(ptr);
+        }
+    }
+
+    //     old_n  new_n ,   
+    Type* reallocate(Type* ptr, size_t old_n, size_t new_n) {
+        if constexpr (kOverAligned) {
+            //realloc    
+            Type* fresh = allocate(new_n);
+            if (ptr != nullptr) {
+                std::memcpy(static_cast<void*>(fresh), ptr, (old_n < new_n ? old_n : new_n) * sizeof(Type));
+                allocator_detail::AlignedFree(ptr);
+            }
+            return fresh;
+        }
+        else {
+            void* fresh = std::realloc(static_cast<void*>(ptr), allocator_detail::CheckedBytes<Type>(new_n));
+            if (fresh == nullptr) throw std::bad_alloc();
+            return static_cast<Type*>(fresh);
+        }
+    }
+
+private:
+    static constexpr bool kOverAligned = alignof(Type) > alignof(std::max_align_t);
+};
+
+template <typename Lhs, typename Rhs>
+bool operator==(const MallocAllocator<Lhs>&, const MallocAllocator<Rhs>&) noexcept {
+    return true;
+}
+
+template <typename Lhs, typename Rhs>
+bool operator!=(const MallocAllocator<Lhs>&, const MallocAllocator<Rhs>&) noexcept {
+    return false;
+}
@@ -0,0 +1,390 @@
+#pragma once
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "growth_policy.h"
+
+enum class MapMode {
+    ReadOnly,   //      
+    ReadWrite,  //       
+    Create      //    (  )
+};
+
+//    ,        .
+//    64-  (,  , ),    .
+//        ,    PushBack.
+//    ftruncate  ,        
+template <typename Type, typename GrowthPolicy = GrowByDoubling>
+class MappedSimpleVector {
+    static_assert(std::is_trivially_copyable_v<Type>, "MappedSimpleVector stores raw bytes of its elements");
+    static_assert(alignof(Type) <= 64, "elements are placed right after a 64-byte header");
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //     path   mode.
+    //  std::system_error   -  std::runtime_error    
+    MappedSimpleVector(const std::string& path, MapMode mode);
+
+    MappedSimpleVector(const MappedSimpleVector&) = delete;
+    MappedSimpleVector& operator=(const MappedSimpleVector&) = delete;
+
+    MappedSimpleVector(MappedSimpleVector&& other) noexcept;
+    MappedSimpleVector& operator=(MappedSimpleVector&& rhs) noexcept;
+
+    //     ,     .
+    //     :    Flush
+    ~MappedSimpleVector();
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return header_ != nullptr ? header_->count : 0;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return cap_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    bool IsReadOnly() const noexcept {
+        return mode_ == MapMode::ReadOnly;
+    }
+
+    //      ,    ,   SIGSEGV
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return Data()[index];
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //     std::logic_error  ,    
+
+    void PushBack(const Type& item);
+
+    //   .     
+    void PopBack();
+
+    //  .     
+    void Resize(size_t new_size);
+
+    //   ,     new_capacity 
+    void Reserve(size_t new_capacity);
+
+    void Clear();
+
+    //      
+    void Flush();
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Iterator begin() noexcept {
+        return Data();
+    }
+
+    Iterator end() noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator begin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator end() const noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator cend() const noexcept {
+        return Data() + GetSize();
+    }
+
+private:
+    struct Header {
+        char magic[8];
+        uint64_t element_size;
+        uint64_t count;
+        uint64_t reserved[5];
+    };
+    static_assert(sizeof(Header) == 64);
+
+    static constexpr char kMagic[8] = {'S', 'V', 'M', 'A', 'P', '0', '1', '\0'};
+
+    int fd_ = -1;
+    MapMode mode_ = MapMode::ReadOnly;
+    Header* header_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    size_t cap_ = 0;
+
+    Type* Data() const noexcept {
+        return header_ != nullptr ? reinterpret_cast<Type*>(header_ + 1) : nullptr;
+    }
+
+    static size_t BytesFor(size_t capacity) noexcept {
+        return sizeof(Header) + capacity * sizeof(Type);
+    }
+
+    //  bytes  
+    void Map(size_t bytes);
+
+    //       new_cap 
+    void Remap(size_t new_cap);
+
+    void RequireWritable() const;
+
+    void Close() noexcept;
+
+    // ,  errno  ,   
+    [[noreturn]] void CloseAndThrow(const std::string& what);
+
+    [[noreturn]] static void ThrowErrno(int error, const std::string& what);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                      //
+///////////////////////////////// /////////////////////////////////////////////////////////////
+//                                                                                                      //
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename GrowthPolicy>
+MappedSimpleVector<Type, GrowthPolicy>::MappedSimpleVector(const std::string& path, MapMode mode) : mode_(mode) {
+    int flags = O_RDWR;
+    if (mode == MapMode::ReadOnly) flags = O_RDONLY;
+    if (mode == MapMode::Create) flags |= O_CREAT | O_TRUNC;
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) ThrowErrno(errno, "open " + path);
+
+    if (mode == MapMode::Create) {
+        if (::ftruncate(fd_, sizeof(Header)) != 0) {
+            CloseAndThrow("ftruncate " + path);
+        }
+        Map(sizeof(Header));
+        std::memcpy(header_->magic, kMagic, sizeof(kMagic));
+        header_->element_size = sizeof(Type);
+        header_->count = 0;
+        return;
+    }
+
+    struct stat info {};
+    if (::fstat(fd_, &info) != 0) {
+        CloseAndThrow("fstat " + path);
+    }
+    size_t file_size = static_cast<size_t>(info.st_size);
+    if (file_size < sizeof(Header)) {
+        Close();
+        throw std::runtime_error(path + ": not a MappedSimpleVector file");
+    }
+    Map(file_size);
+    cap_ = (file_size - sizeof(Header)) / sizeof(Type);
+    if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0 || header_->element_size != sizeof(Type)
+        || header_->count > cap_) {
+        Close();
+        throw std::runtime_error(path + ": not a MappedSimpleVector file of this element type");
+    }
+}
+
+template <typename Type, typename GrowthPolicy>
+MappedSimpleVector<Type, GrowthPolicy>::MappedSimpleVector(MappedSimpleVector&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)), mode_(other.mode_), header_(std::exchange(other.header_, nullptr)),
+    mapped_bytes_(std::exchange(other.mapped_bytes_, 0)), cap_(std::exchange(other.cap_, 0)) {
+}
+
+template <typename Type, typename GrowthPolicy>
+MappedSimpleVector<Type, GrowthPolicy>& MappedSimpleVector<Type, GrowthPolicy>::operator=(MappedSimpleVector&& rhs) noexcept {
+    if (this == &rhs) return *this;
+    Close();
+    fd_ = std::exchange(rhs.fd_, -1);
+    mode_ = rhs.mode_;
+    header_ = std::exchange(rhs.header_, nullptr);
+    mapped_bytes_ = std::exchange(rhs.mapped_bytes_, 0);
+    cap_ = std::exchange(rhs.cap_, 0);
+    return *this;
+}
+
+template <typename Type, typename GrowthPolicy>
+MappedSimpleVector<Type, GrowthPolicy>::~MappedSimpleVector() {
+    Close();
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::PushBack(const Type& item) {
+    RequireWritable();
+    size_t size = GetSize();
+    if (size >= cap_) {
+        //item    ,   
+        Type copy(item);
+        Remap(GrowthPolicy::Grow(cap_, size + 1, sizeof(Type)));
+        Data()[size] = copy;
+    }
+    else {
+        Data()[size] = item;
+    }
+    header_->count = size + 1;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::PopBack() {
+    RequireWritable();
+    assert(!IsEmpty());
+    --header_->count;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Resize(size_t new_size) {
+    RequireWritable();
+    size_t size = GetSize();
+    if (new_size > cap_) {
+        Remap(GrowthPolicy::Grow(cap_, new_size, sizeof(Type)));
+    }
+    if (new_size > size) {
+        std::memset(static_cast<void*>(Data() + size), 0, (new_size - size) * sizeof(Type));
+    }
+    header_->count = new_size;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Reserve(size_t new_capacity) {
+    RequireWritable();
+    if (new_capacity > cap_) {
+        Remap(new_capacity);
+    }
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Clear() {
+    RequireWritable();
+    header_->count = 0;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Flush() {
+    if (IsReadOnly() || header_ == nullptr) return;
+    if (::msync(header_, mapped_bytes_, MS_SYNC) != 0) ThrowErrno(errno, "msync");
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  ===>
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Map(size_t bytes) {
+    int prot = IsReadOnly() ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* addr = ::mmap(nullptr, bytes, prot, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+        CloseAndThrow("mmap");
+    }
+    header_ = static_cast<Header*>(addr);
+    mapped_bytes_ = bytes;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Remap(size_t new_cap) {
+    size_t new_bytes = BytesFor(new_cap);
+    if (::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) ThrowErrno(errno, "ftruncate");
+#ifdef __linux__
+    void* addr = ::mremap(header_, mapped_bytes_, new_bytes, MREMAP_MAYMOVE);
+    if (addr == MAP_FAILED) ThrowErrno(errno, "mremap");
+    header_ = static_cast<Header*>(addr);
+    mapped_bytes_ = new_bytes;
+#else
+    ::munmap(header_, mapped_bytes_);
+    header_ = nullptr;
+    Map(new_bytes);
+#endif
+    cap_ = new_cap;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::RequireWritable() const {
+    if (IsReadOnly()) throw std::logic_error("MappedSimpleVector is opened read-only");
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::Close() noexcept {
+    if (header_ != nullptr) {
+        size_t used = BytesFor(header_->count);
+        ::munmap(header_, mapped_bytes_);
+        header_ = nullptr;
+        //     :     
+        if (!IsReadOnly() && fd_ >= 0) {
+            [[maybe_unused]] int result = ::ftruncate(fd_, static_cast<off_t>(used));
+        }
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    mapped_bytes_ = 0;
+    cap_ = 0;
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::CloseAndThrow(const std::string& what) {
+    int error = errno;
+    Close();
+    ThrowErrno(error, what);
+}
+
+template <typename Type, typename GrowthPolicy>
+void MappedSimpleVector<Type, GrowthPolicy>::ThrowErrno(int error, const std::string& what) {
+    throw std::system_error(error, std::generic_category(), what);
+}
@@ -0,0 +1,306 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <new>
+#include <utility>
+#include "malloc_allocator.h"
+
+
+//      ResourceAllocator
+class MemoryResource {
+public:
+    virtual ~MemoryResource() = default;
+
+    //  bytes ,   alignment
+    virtual void* Allocate(size_t bytes, size_t alignment) = 0;
+
+    //  ,   Allocate    bytes  alignment
+    virtual void Deallocate(void* ptr, size_t bytes, size_t alignment) noexcept = 0;
+
+    //      
+    virtual void Reset() noexcept {
+    }
+};
+
+//    operator new/operator delete
+class NewDeleteResource final : public MemoryResource {
+public:
+    void* Allocate(size_t bytes, size_t alignment) override {
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    void Deallocate(void* ptr, size_t, size_t alignment) noexcept override {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    //     ResourceAllocator
+    static NewDeleteResource* Instance() noexcept {
+        static NewDeleteResource resource;
+        return &resource;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> 
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//       .
+// Deallocate   ,      Reset  
+class MonotonicArena final : public MemoryResource {
+public:
+    explicit MonotonicArena(size_t first_block_size = 4096) noexcept
+        : next_block_size_(first_block_size > 0 ? first_block_size : 4096) {
+    }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() override {
+        Reset();
+    }
+
+    void* Allocate(size_t bytes, size_t alignment) override {
+        uintptr_t aligned = (current_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        if (current_ == 0 || aligned + bytes > end_) {
+            AddBlock(bytes + alignment);
+            aligned = (current_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        }
+        current_ = aligned + bytes;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void Deallocate(void*, size_t, size_t) noexcept override {
+    }
+
+    void Reset() noexcept override {
+        while (blocks_ != nullptr) {
+            Block* next = blocks_->next;
+            ::operator delete(blocks_);
+            blocks_ = next;
+        }
+        current_ = 0;
+        end_ = 0;
+    }
+
+    //    ,   
+    size_t GetReservedBytes() const noexcept {
+        size_t total = 0;
+        for (Block* block = blocks_; block != nullptr; block = block->next) {
+            total += block->size;
+        }
+        return total;
+    }
+
+private:
+    struct Block {
+        Block* next;
+        size_t size;
+    };
+
+    Block* blocks_ = nullptr;
+    uintptr_t current_ = 0;
+    uintptr_t end_ = 0;
+    size_t next_block_size_;
+
+    //     min_size ,    
+    void AddBlock(size_t min_size) {
+        size_t size = std::max(next_block_size_, min_size + sizeof(Block));
+        Block* block = static_cast<Block*>(::operator new(size));
+        block->next = blocks_;
+        block->size = size;
+        blocks_ = block;
+        current_ = reinterpret_cast<uintptr_t>(block + 1);
+        end_ = reinterpret_cast<uintptr_t>(block) + size;
+        next_block_size_ = size * 2;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//        16  kMaxPooledSize .
+//          .
+//     operator new, Reset   
+class PoolResource final : public MemoryResource {
+public:
+    static constexpr size_t kMinPooledSize = 16;
+    static constexpr size_t kMaxPooledSize = 64 * 1024;
+
+    explicit PoolResource(size_t blocks_per_chunk = 32) noexcept
+        : blocks_per_chunk_(blocks_per_chunk > 0 ? blocks_per_chunk : 32) {
+    }
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    ~PoolResource() override {
+        Reset();
+    }
+
+    void* Allocate(size_t bytes, size_t alignment) override {
+        if (bytes > kMaxPooledSize || alignment > kMinPooledSize) {
+            return AllocateLarge(bytes, alignment);
+        }
+        size_t index = ClassIndex(bytes);
+        if (free_lists_[index] == nullptr) {
+            Refill(index);
+        }
+        FreeNode* node = free_lists_[index];
+        free_lists_[index] = node->next;
+        return node;
+    }
+
+    void Deallocate(void* ptr, size_t bytes, size_t alignment) noexcept override {
+        if (bytes > kMaxPooledSize || alignment > kMinPooledSize) {
+            DeallocateLarge(ptr);
+            return;
+        }
+        size_t index = ClassIndex(bytes);
+        FreeNode* node = static_cast<FreeNode*>(ptr);
+        node->next = free_lists_[index];
+        free_lists_[index] = node;
+    }
+
+    void Reset() noexcept override {
+        while (chunks_ != nullptr) {
+            FreeNode* next = chunks_->next;
+            ::operator delete(chunks_);
+            chunks_ = next;
+        }
+        while (large_ != nullptr) {
+            DeallocateLarge(large_ + 1);
+        }
+        for (FreeNode*& list : free_lists_) {
+            list = nullptr;
+        }
+    }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    struct LargeHeader {
+        LargeHeader* prev;
+        LargeHeader* next;
+        void* raw;
+        size_t alignment;
+    };
+
+    static constexpr size_t kClassCount = 13;   // 16, 32, ... , 64 
+
+    FreeNode* free_lists_[kClassCount] = {};
+    FreeNode* chunks_ = nullptr;
+    LargeHeader* large_ = nullptr;
+    size_t blocks_per_chunk_;
+
+    static size_t ClassIndex(size_t bytes) noexcept {
+        size_t index = 0;
+        size_t class_size = kMinPooledSize;
+        while (class_size < bytes) {
+            class_size *= 2;
+            ++index;
+        }
+        return index;
+    }
+
+    //       index
+    void Refill(size_t index) {
+        size_t class_size = kMinPooledSize << index;
+        size_t count = std::max<size_t>(1, std::min(blocks_per_chunk_, 4 * kMaxPooledSize / class_size));
+        char* chunk = static_cast<char*>(::operator new(kMinPooledSize + count * class_size));
+        FreeNode* chunk_node = reinterpret_cast<FreeNode*>(chunk);
+        chunk_node->next = chunks_;
+        chunks_ = chunk_node;
+        for (size_t i = count; i > 0; --i) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(chunk + kMinPooledSize + (i - 1) * class_size);
+            node->next = free_lists_[index];
+            free_lists_[index] = node;
+        }
+    }
+
+    //       
+    void* AllocateLarge(size_t bytes, size_t alignment) {
+        alignment = std::max(alignment, alignof(LargeHeader));
+        size_t offset = (sizeof(LargeHeader) + alignment - 1) & ~(alignment - 1);
+        char* raw = static_cast<char*>(::operator new(offset + bytes, std::align_val_t(alignment)));
+        LargeHeader* header = reinterpret_cast<LargeHeader*>(raw + offset) - 1;
+        header->prev = nullptr;
+        header->next = large_;
+        header->raw = raw;
+        header->alignment = alignment;
+        if (large_ != nullptr) large_->prev = header;
+        large_ = header;
+        return header + 1;
+    }
+
+    void DeallocateLarge(void* ptr) noexcept {
+        LargeHeader* header = static_cast<LargeHeader*>(ptr) - 1;
+        if (header->prev != nullptr) header->prev->next = header->next;
+        else large_ = header->next;
+        if (header->next != nullptr) header->next->prev = header->prev;
+        ::operator delete(header->raw, std::align_val_t(header->alignment));
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  MemoryResource
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//   SimpleVector/ArrayPtr,     MemoryResource.
+//          ,   
+template <typename Type>
+class ResourceAllocator {
+public:
+    using value_type = Type;
+
+    ResourceAllocator() noexcept = default;
+
+    ResourceAllocator(MemoryResource* resource) noexcept : resource_(resource) {
+        assert(resource_ != nullptr);
+    }
+
+    template <typename Other>
+    ResourceAllocator(const ResourceAllocator<Other>& other) noexcept : resource_(other.GetResource()) {
+    }
+
+    Type* allocate(size_t n) {
+        return static_cast<Type*>(resource_->Allocate(allocator_detail::CheckedBytes<Type>(n), alignof(Type)));
+    }
+
+    void deallocate(Type* ptr, size_t n) noexcept {
+        resource_->Deallocate(ptr, n * sizeof(Type), alignof(Type));
+    }
+
+    MemoryResource* GetResource() const noexcept {
+        return resource_;
+    }
+
+private:
+    MemoryResource* resource_ = NewDeleteResource::Instance();
+};
+
+template <typename Lhs, typename Rhs>
+bool operator==(const ResourceAllocator<Lhs>& lhs, const ResourceAllocator<Rhs>& rhs) noexcept {
+    return lhs.GetResource() == rhs.GetResource();
+}
+
+template <typename Lhs, typename Rhs>
+bool operator!=(const ResourceAllocator<Lhs>& lhs, const ResourceAllocator<Rhs>& rhs) noexcept {
+    return !(lhs == rhs);
+}
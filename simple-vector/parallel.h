@@ -0,0 +1,89 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+//   ,     .
+//        :    
+//     NUMA-  ,       
+struct ParallelPolicy {
+    //  , 0 -    
+    size_t threads = 0;
+    //      
+    size_t min_bytes_per_thread = 16 * 1024 * 1024;
+};
+
+namespace parallel_detail {
+
+inline constexpr size_t kPageSize = 4096;
+
+inline size_t ThreadCount(size_t bytes, const ParallelPolicy& policy) noexcept {
+    size_t threads = policy.threads > 0 ? policy.threads : std::thread::hardware_concurrency();
+    size_t useful = bytes / std::max<size_t>(policy.min_bytes_per_thread, 1);
+    return std::max<size_t>(1, std::min(threads, useful));
+}
+
+//  [0, count)        construct(first, last)     .
+// construct     ,  .      ,
+//     destroy(first, last),     .
+//     ,      
+template <typename Construct, typename Destroy>
+void ParallelConstruct(size_t count, size_t element_size, const ParallelPolicy& policy,
+                       Construct construct, Destroy destroy) {
+    size_t threads = ThreadCount(count * element_size, policy);
+    if (threads <= 1) {
+        construct(size_t(0), count);
+        return;
+    }
+    size_t page_elements = std::max<size_t>(1, kPageSize / element_size);
+    size_t chunk = (count + threads - 1) / threads;
+    chunk = (chunk + page_elements - 1) / page_elements * page_elements;
+    size_t chunks = (count + chunk - 1) / chunk;
+
+    std::vector<std::exception_ptr> errors(chunks);
+    auto run = [&](size_t index) {
+        try {
+            construct(index * chunk, std::min(count, (index + 1) * chunk));
+        } catch (...) {
+            errors[index] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    size_t next = 1;
+    try {
+        for (; next < chunks; ++next) {
+            workers.emplace_back(run, next);
+        }
+    } catch (const std::system_error&) {
+    }
+    for (size_t index = next; index < chunks; ++index) {
+        run(index);
+    }
+    run(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::exception_ptr first_error;
+    for (size_t index = 0; index < chunks; ++index) {
+        if (errors[index] && !first_error) {
+            first_error = errors[index];
+        }
+    }
+    if (first_error) {
+        for (size_t index = 0; index < chunks; ++index) {
+            if (!errors[index]) {
+                destroy(index * chunk, std::min(count, (index + 1) * chunk));
+            }
+        }
+        std::rethrow_exception(first_error);
+    }
+}
+
+} // namespace parallel_detail
@@ -0,0 +1,311 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "simple_vector.h"
+
+
+//   SimpleVector: 24-       .
+//     ;         
+struct SerializedHeader {
+    char magic[4];
+    uint16_t version;
+    uint8_t endianness;
+    uint8_t reserved;
+    uint32_t element_size;
+    uint32_t reserved2;
+    uint64_t count;
+};
+static_assert(sizeof(SerializedHeader) == 24);
+
+namespace serialization_detail {
+
+inline constexpr char kMagic[4] = {'S', 'V', 'E', 'C'};
+inline constexpr uint16_t kVersion = 1;
+inline constexpr uint8_t kLittleEndian = 1;
+inline constexpr uint8_t kBigEndian = 2;
+
+inline uint8_t NativeEndianness() noexcept {
+    const uint16_t probe = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &probe, 1);
+    return first_byte == 1 ? kLittleEndian : kBigEndian;
+}
+
+template <typename Type>
+SerializedHeader MakeHeader(size_t count) noexcept {
+    SerializedHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.endianness = NativeEndianness();
+    header.element_size = sizeof(Type);
+    header.count = count;
+    return header;
+}
+
+// std::runtime_error,      Type     
+template <typename Type>
+void CheckHeader(const SerializedHeader& header) {
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("not a serialized SimpleVector");
+    }
+    if (header.version != kVersion) {
+        throw std::runtime_error("unsupported SimpleVector format version " + std::to_string(header.version));
+    }
+    if (header.endianness != NativeEndianness()) {
+        throw std::runtime_error("SimpleVector was serialized with a different byte order");
+    }
+    if (header.element_size != sizeof(Type)) {
+        throw std::runtime_error("SimpleVector element size mismatch");
+    }
+}
+
+inline constexpr uint64_t kUnknownLength = std::numeric_limits<uint64_t>::max();
+
+//   .  std::runtime_error,       size_t
+//   available  :         
+template <typename Type>
+size_t CheckCount(uint64_t count, uint64_t available) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(Type)) {
+        throw std::runtime_error("SimpleVector element count " + std::to_string(count) + " is too large");
+    }
+    if (count * sizeof(Type) > available) {
+        throw std::runtime_error("serialized SimpleVector is shorter than its header says");
+    }
+    return static_cast<size_t>(count);
+}
+
+//       .      
+inline uint64_t RemainingBytes(int fd) noexcept {
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        return kUnknownLength;
+    }
+    off_t position = ::lseek(fd, 0, SEEK_CUR);
+    if (position < 0) {
+        return kUnknownLength;
+    }
+    return position < info.st_size ? static_cast<uint64_t>(info.st_size - position) : 0;
+}
+
+//     .    
+inline uint64_t RemainingBytes(std::istream& input) {
+    const std::istream::pos_type position = input.tellg();
+    if (position == std::istream::pos_type(-1)) {
+        return kUnknownLength;
+    }
+    input.seekg(0, std::ios::end);
+    const std::istream::pos_type end = input.tellg();
+    input.clear();
+    input.seekg(position);
+    if (end == std::istream::pos_type(-1) || end < position) {
+        return kUnknownLength;
+    }
+    return static_cast<uint64_t>(end - position);
+}
+
+[[noreturn]] inline void ThrowErrno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+//  bytes .  false,    ,    
+inline bool ReadExactly(int fd, void* buffer, size_t bytes) {
+    char* out = static_cast<char*>(buffer);
+    size_t done = 0;
+    while (done < bytes) {
+        ssize_t got = ::read(fd, out + done, bytes - done);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            ThrowErrno("read");
+        }
+        if (got == 0) {
+            if (done == 0) return false;
+            throw std::runtime_error("unexpected end of serialized SimpleVector");
+        }
+        done += static_cast<size_t>(got);
+    }
+    return true;
+}
+
+//    
+inline void WriteAll(int fd, const char* data, size_t bytes) {
+    while (bytes > 0) {
+        ssize_t put = ::write(fd, data, bytes);
+        if (put < 0) {
+            if (errno == EINTR) continue;
+            ThrowErrno("write");
+        }
+        data += put;
+        bytes -= static_cast<size_t>(put);
+    }
+}
+
+} // namespace serialization_detail
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> 
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//      writev    
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void WriteTo(int fd, const SimpleVector<Type, Allocator, GrowthPolicy>& vector) {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable elements can be written as bytes");
+    using namespace serialization_detail;
+    SerializedHeader header = MakeHeader<Type>(vector.GetSize());
+    const size_t header_bytes = sizeof(header);
+    const size_t data_bytes = vector.GetSize() * sizeof(Type);
+
+    iovec parts[2] = {
+        {&header, header_bytes},
+        {const_cast<Type*>(vector.begin()), data_bytes},
+    };
+    ssize_t put;
+    do {
+        put = ::writev(fd, parts, data_bytes > 0 ? 2 : 1);
+    } while (put < 0 && errno == EINTR);
+    if (put < 0) ThrowErrno("writev");
+
+    // :    write
+    size_t written = static_cast<size_t>(put);
+    if (written < header_bytes) {
+        WriteAll(fd, reinterpret_cast<const char*>(&header) + written, header_bytes - written);
+        written = header_bytes;
+    }
+    const char* data = reinterpret_cast<const char*>(vector.begin());
+    WriteAll(fd, data + (written - header_bytes), data_bytes - (written - header_bytes));
+}
+
+//   vector   fd.
+//          read   .
+//     :   vector  
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ReadFrom(int fd, SimpleVector<Type, Allocator, GrowthPolicy>& vector) {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable elements can be read as bytes");
+    using namespace serialization_detail;
+    SerializedHeader header;
+    if (!ReadExactly(fd, &header, sizeof(header))) {
+        throw std::runtime_error("unexpected end of serialized SimpleVector");
+    }
+    CheckHeader<Type>(header);
+    const size_t count = CheckCount<Type>(header.count, RemainingBytes(fd));
+    SimpleVector<Type, Allocator, GrowthPolicy> loaded(vector.GetAllocator());
+    loaded.ResizeForOverwrite(count);
+    if (count > 0 && !ReadExactly(fd, loaded.begin(), count * sizeof(Type))) {
+        throw std::runtime_error("unexpected end of serialized SimpleVector");
+    }
+    vector.swap(loaded);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//     std::ostream.  std::runtime_error,      
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void WriteTo(std::ostream& output, const SimpleVector<Type, Allocator, GrowthPolicy>& vector) {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable elements can be written as bytes");
+    SerializedHeader header = serialization_detail::MakeHeader<Type>(vector.GetSize());
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(vector.begin()), vector.GetSize() * sizeof(Type));
+    if (!output) throw std::runtime_error("failed to write SimpleVector to stream");
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void ReadFrom(std::istream& input, SimpleVector<Type, Allocator, GrowthPolicy>& vector) {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable elements can be read as bytes");
+    using namespace serialization_detail;
+    SerializedHeader header;
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("unexpected end of serialized SimpleVector");
+    }
+    CheckHeader<Type>(header);
+    const size_t count = CheckCount<Type>(header.count, RemainingBytes(input));
+    SimpleVector<Type, Allocator, GrowthPolicy> loaded(vector.GetAllocator());
+    loaded.ResizeForOverwrite(count);
+    if (!input.read(reinterpret_cast<char*>(loaded.begin()), count * sizeof(Type))) {
+        throw std::runtime_error("unexpected end of serialized SimpleVector");
+    }
+    vector.swap(loaded);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>   
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//    ,    :
+//     ChunkedReader<float> reader(fd);
+//     SimpleVector<float> chunk;
+//     while (reader.Next(chunk, 1 << 20)) { ... }
+template <typename Type>
+class ChunkedReader {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable elements can be read as bytes");
+public:
+    //    .    
+    explicit ChunkedReader(int fd) : fd_(fd) {
+        SerializedHeader header;
+        if (!serialization_detail::ReadExactly(fd_, &header, sizeof(header))) {
+            throw std::runtime_error("unexpected end of serialized SimpleVector");
+        }
+        serialization_detail::CheckHeader<Type>(header);
+        const uint64_t available = serialization_detail::RemainingBytes(fd_);
+        remaining_ = total_ = serialization_detail::CheckCount<Type>(header.count, available);
+    }
+
+    //   chunk     max_elements .
+    //  chunk   .  false,   .
+    //   , chunk ,       
+    template <typename Allocator, typename GrowthPolicy>
+    bool Next(SimpleVector<Type, Allocator, GrowthPolicy>& chunk, size_t max_elements) {
+        size_t count = std::min<uint64_t>(remaining_, max_elements);
+        chunk.ResizeForOverwrite(count);
+        if (count == 0) return false;
+        try {
+            if (!serialization_detail::ReadExactly(fd_, chunk.begin(), count * sizeof(Type))) {
+                throw std::runtime_error("unexpected end of serialized SimpleVector");
+            }
+        } catch (...) {
+            chunk.Clear();
+            throw;
+        }
+        remaining_ -= count;
+        return true;
+    }
+
+    //  ,   
+    size_t GetTotal() const noexcept {
+        return total_;
+    }
+
+    //     
+    size_t GetRemaining() const noexcept {
+        return remaining_;
+    }
+
+private:
+    int fd_;
+    uint64_t total_ = 0;
+    uint64_t remaining_ = 0;
+};
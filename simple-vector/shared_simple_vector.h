@@ -0,0 +1,446 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include "simple_vector.h"
+
+
+template <typename Type, typename Allocator = MallocAllocator<Type>, typename GrowthPolicy = GrowByDoubling>
+class FrozenSimpleVector;
+
+namespace shared_detail {
+
+//  :     
+template <typename Vector>
+struct Block {
+    std::atomic<size_t> refs{1};
+    Vector items;
+
+    explicit Block(Vector&& vector) : items(std::move(vector)) {
+    }
+};
+
+template <typename Vector>
+void Acquire(Block<Vector>* block) noexcept {
+    if (block != nullptr) {
+        block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template <typename Vector>
+void Release(Block<Vector>* block) noexcept {
+    //acq_rel:        
+    if (block != nullptr && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete block;
+    }
+}
+
+} // namespace shared_detail
+
+//     .
+//    ,          ,
+//           .
+//      (operator[], At, begin, PushBack, Insert, Erase...)
+//   ,    - .
+//        ,   - .
+//   ,   ,     :
+//        .       Freeze()
+template <typename Type, typename Allocator = MallocAllocator<Type>, typename GrowthPolicy = GrowByDoubling>
+class SharedSimpleVector {
+public:
+    using Vector = SimpleVector<Type, Allocator, GrowthPolicy>;
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SharedSimpleVector() noexcept = default;
+
+    //   vector   
+    explicit SharedSimpleVector(Vector&& vector) : block_(new Block(std::move(vector))) {
+    }
+
+    explicit SharedSimpleVector(const Vector& vector) : SharedSimpleVector(Vector(vector)) {
+    }
+
+    SharedSimpleVector(std::initializer_list<Type> init) : SharedSimpleVector(Vector(init)) {
+    }
+
+    //   :    
+    explicit SharedSimpleVector(const FrozenSimpleVector<Type, Allocator, GrowthPolicy>& frozen) noexcept;
+
+    //  other,   
+    SharedSimpleVector(const SharedSimpleVector& other) noexcept : block_(other.block_) {
+        shared_detail::Acquire(block_);
+    }
+
+    SharedSimpleVector(SharedSimpleVector&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {
+    }
+
+    ~SharedSimpleVector() {
+        shared_detail::Release(block_);
+    }
+
+    SharedSimpleVector& operator=(const SharedSimpleVector& rhs) noexcept {
+        SharedSimpleVector temp(rhs);
+        swap(temp);
+        return *this;
+    }
+
+    SharedSimpleVector& operator=(SharedSimpleVector&& rhs) noexcept {
+        SharedSimpleVector temp(std::move(rhs));
+        swap(temp);
+        return *this;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return block_ == nullptr ? 0 : block_->items.GetSize();
+    }
+
+    size_t GetCapacity() const noexcept {
+        return block_ == nullptr ? 0 : block_->items.GetCapacity();
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //    ,  
+    size_t GetUseCount() const noexcept {
+        return block_ == nullptr ? 0 : block_->refs.load(std::memory_order_relaxed);
+    }
+
+    //  ,     
+    bool IsShared() const noexcept {
+        return GetUseCount() > 1;
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return block_->items[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return block_->items[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return block_ == nullptr ? nullptr : block_->items.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return block_ == nullptr ? nullptr : block_->items.end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    bool Contains(const Type& value) const {
+        return block_ != nullptr && block_->items.Contains(value);
+    }
+
+    //    .   :  
+    //      ,       
+    FrozenSimpleVector<Type, Allocator, GrowthPolicy> Freeze() const noexcept;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>   
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Type& operator[](size_t index) {
+        assert(index < GetSize());
+        auto hold = Detach();
+        return block_->items[index];
+    }
+
+    Type& At(size_t index) {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        auto hold = Detach();
+        return block_->items[index];
+    }
+
+    Iterator begin() {
+        auto hold = Detach();
+        return block_->items.begin();
+    }
+
+    Iterator end() {
+        auto hold = Detach();
+        return block_->items.end();
+    }
+
+    //      .    
+    Vector& Mutable() {
+        auto hold = Detach();
+        return block_->items;
+    }
+
+    void PushBack(const Type& item) {
+        auto hold = Detach();
+        block_->items.PushBack(item);
+    }
+
+    void PushBack(Type&& item) {
+        auto hold = Detach();
+        block_->items.PushBack(std::move(item));
+    }
+
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        auto hold = Detach();
+        return block_->items.EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    Iterator Insert(ConstIterator pos, const Type& value);
+    Iterator Insert(ConstIterator pos, Type&& value);
+
+    Iterator Erase(ConstIterator pos);
+    Iterator Erase(ConstIterator first, ConstIterator last);
+
+    void PopBack() {
+        assert(!IsEmpty());
+        auto hold = Detach();
+        block_->items.PopBack();
+    }
+
+    //    ,   
+    void Clear() noexcept;
+
+    void Resize(size_t new_size) {
+        auto hold = Detach();
+        block_->items.Resize(new_size);
+    }
+
+    void Reserve(size_t new_capacity) {
+        auto hold = Detach();
+        block_->items.Reserve(new_capacity);
+    }
+
+    void swap(SharedSimpleVector& other) noexcept {
+        std::swap(block_, other.block_);
+    }
+
+    bool operator==(const SharedSimpleVector& rhs) const {
+        return block_ == rhs.block_ || (GetSize() == rhs.GetSize() && std::equal(begin(), end(), rhs.begin()));
+    }
+
+    bool operator!=(const SharedSimpleVector& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    using Block = shared_detail::Block<Vector>;
+
+    friend class FrozenSimpleVector<Type, Allocator, GrowthPolicy>;
+
+    Block* block_ = nullptr;
+
+    //       :      
+    class Hold {
+    public:
+        explicit Hold(Block* block) noexcept : block_(block) {
+        }
+
+        Hold(const Hold&) = delete;
+        Hold& operator=(const Hold&) = delete;
+
+        ~Hold() {
+            shared_detail::Release(block_);
+        }
+
+    private:
+        Block* block_;
+    };
+
+    //  ,  ,    - 
+    [[nodiscard]] Hold Detach();
+
+    size_t IndexOf(ConstIterator pos) const noexcept {
+        assert(pos >= begin() && pos <= end());
+        return pos - begin();
+    }
+};
+
+//   SharedSimpleVector.    ,
+//        :      
+template <typename Type, typename Allocator, typename GrowthPolicy>
+class FrozenSimpleVector {
+public:
+    using Vector = SimpleVector<Type, Allocator, GrowthPolicy>;
+    using ConstIterator = const Type*;
+
+    FrozenSimpleVector() noexcept = default;
+
+    //  vector,   
+    explicit FrozenSimpleVector(Vector&& vector) : block_(new Block(std::move(vector))) {
+    }
+
+    FrozenSimpleVector(const FrozenSimpleVector& other) noexcept : block_(other.block_) {
+        shared_detail::Acquire(block_);
+    }
+
+    FrozenSimpleVector(FrozenSimpleVector&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {
+    }
+
+    ~FrozenSimpleVector() {
+        shared_detail::Release(block_);
+    }
+
+    FrozenSimpleVector& operator=(FrozenSimpleVector rhs) noexcept {
+        std::swap(block_, rhs.block_);
+        return *this;
+    }
+
+    size_t GetSize() const noexcept {
+        return block_ == nullptr ? 0 : block_->items.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return block_->items[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return block_->items[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return block_ == nullptr ? nullptr : block_->items.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return block_ == nullptr ? nullptr : block_->items.end();
+    }
+
+    bool Contains(const Type& value) const {
+        return block_ != nullptr && block_->items.Contains(value);
+    }
+
+    //     ,     
+    const Vector& Get() const noexcept {
+        static const Vector empty;
+        return block_ == nullptr ? empty : block_->items;
+    }
+
+private:
+    using Block = shared_detail::Block<Vector>;
+
+    friend class SharedSimpleVector<Type, Allocator, GrowthPolicy>;
+
+    Block* block_ = nullptr;
+
+    explicit FrozenSimpleVector(Block* block) noexcept : block_(block) {
+        shared_detail::Acquire(block_);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SharedSimpleVector<Type, Allocator, GrowthPolicy>::SharedSimpleVector(
+    const FrozenSimpleVector<Type, Allocator, GrowthPolicy>& frozen) noexcept : block_(frozen.block_) {
+    shared_detail::Acquire(block_);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+FrozenSimpleVector<Type, Allocator, GrowthPolicy> SharedSimpleVector<Type, Allocator, GrowthPolicy>::Freeze() const noexcept {
+    return FrozenSimpleVector<Type, Allocator, GrowthPolicy>(block_);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+auto SharedSimpleVector<Type, Allocator, GrowthPolicy>::Detach() -> Hold {
+    if (block_ == nullptr) {
+        block_ = new Block(Vector());
+        return Hold(nullptr);
+    }
+    //acquire:   ,  ,   ,     
+    if (block_->refs.load(std::memory_order_acquire) == 1) {
+        return Hold(nullptr);
+    }
+    Block* fresh = new Block(Vector(block_->items));
+    return Hold(std::exchange(block_, fresh));
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type* SharedSimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, const Type& value) {
+    size_t index = IndexOf(pos);
+    auto hold = Detach();
+    return block_->items.Insert(block_->items.cbegin() + index, value);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type* SharedSimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, Type&& value) {
+    size_t index = IndexOf(pos);
+    auto hold = Detach();
+    return block_->items.Insert(block_->items.cbegin() + index, std::move(value));
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type* SharedSimpleVector<Type, Allocator, GrowthPolicy>::Erase(ConstIterator pos) {
+    size_t index = IndexOf(pos);
+    assert(index < GetSize());
+    auto hold = Detach();
+    return block_->items.Erase(block_->items.cbegin() + index);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+Type* SharedSimpleVector<Type, Allocator, GrowthPolicy>::Erase(ConstIterator first, ConstIterator last) {
+    size_t from = IndexOf(first);
+    size_t to = IndexOf(last);
+    auto hold = Detach();
+    return block_->items.Erase(block_->items.cbegin() + from, block_->items.cbegin() + to);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void SharedSimpleVector<Type, Allocator, GrowthPolicy>::Clear() noexcept {
+    if (IsShared()) {
+        shared_detail::Release(std::exchange(block_, nullptr));
+    }
+    else if (block_ != nullptr) {
+        block_->items.Clear();
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void swap(SharedSimpleVector<Type, Allocator, GrowthPolicy>& lhs, SharedSimpleVector<Type, Allocator, GrowthPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
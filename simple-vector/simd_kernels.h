@@ -0,0 +1,430 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SIMPLE_VECTOR_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define SIMPLE_VECTOR_X86_SIMD 0
+#endif
+
+
+//        .
+//   (SSE2, AVX2, AVX-512)       ,
+//        .
+//    std: float   , NaN   , -0.0 == 0.0
+namespace simd {
+
+enum class Level {
+    Scalar,
+    Sse2,
+    Avx2,
+    Avx512,
+};
+
+// ,     
+template <typename Type>
+inline constexpr bool kVectorizable = std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool>
+    && (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8);
+
+namespace detail {
+
+template <typename Type>
+size_t ScalarMismatch(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    size_t i = 0;
+    while (i < count && lhs[i] == rhs[i]) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename Type>
+size_t ScalarFind(const Type* data, size_t count, Type value) noexcept {
+    size_t i = 0;
+    while (i < count && !(data[i] == value)) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename Type>
+size_t ScalarCount(const Type* data, size_t count, Type value) noexcept {
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        found += data[i] == value;
+    }
+    return found;
+}
+
+#if SIMPLE_VECTOR_X86_SIMD
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> 
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//    kBytes       ,
+//      kMaskBits<Type> 
+
+struct Sse2 {
+    static constexpr size_t kBytes = 16;
+    template <typename Type>
+    static constexpr unsigned kMaskBits = sizeof(Type);
+
+    template <typename Type>
+    [[gnu::target("sse2")]] static uint64_t EqMask(const Type* lhs, const Type* rhs) noexcept {
+        return Compare<Type>(Load(lhs), Load(rhs));
+    }
+
+    template <typename Type>
+    [[gnu::target("sse2")]] static uint64_t EqMask(const Type* data, Type value) noexcept {
+        return Compare<Type>(Load(data), Splat(value));
+    }
+
+private:
+    template <typename Type>
+    [[gnu::target("sse2")]] static __m128i Load(const Type* data) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    template <typename Type>
+    [[gnu::target("sse2")]] static __m128i Splat(Type value) noexcept {
+        if constexpr (std::is_same_v<Type, float>) return _mm_castps_si128(_mm_set1_ps(value));
+        else if constexpr (std::is_same_v<Type, double>) return _mm_castpd_si128(_mm_set1_pd(value));
+        else if constexpr (sizeof(Type) == 1) return _mm_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(Type) == 2) return _mm_set1_epi16(static_cast<short>(value));
+        else if constexpr (sizeof(Type) == 4) return _mm_set1_epi32(static_cast<int>(value));
+        else return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+
+    template <typename Type>
+    [[gnu::target("sse2")]] static uint64_t Compare(__m128i lhs, __m128i rhs) noexcept {
+        __m128i equal;
+        if constexpr (std::is_same_v<Type, float>) {
+            equal = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(lhs), _mm_castsi128_ps(rhs)));
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            equal = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(lhs), _mm_castsi128_pd(rhs)));
+        }
+        else if constexpr (sizeof(Type) == 1) equal = _mm_cmpeq_epi8(lhs, rhs);
+        else if constexpr (sizeof(Type) == 2) equal = _mm_cmpeq_epi16(lhs, rhs);
+        else if constexpr (sizeof(Type) == 4) equal = _mm_cmpeq_epi32(lhs, rhs);
+        else {
+            // SSE2   64- :    
+            __m128i halves = _mm_cmpeq_epi32(lhs, rhs);
+            equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        return static_cast<uint32_t>(_mm_movemask_epi8(equal));
+    }
+};
+
+struct Avx2 {
+    static constexpr size_t kBytes = 32;
+    template <typename Type>
+    static constexpr unsigned kMaskBits = sizeof(Type);
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static uint64_t EqMask(const Type* lhs, const Type* rhs) noexcept {
+        return Compare<Type>(Load(lhs), Load(rhs));
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static uint64_t EqMask(const Type* data, Type value) noexcept {
+        return Compare<Type>(Load(data), Splat(value));
+    }
+
+private:
+    template <typename Type>
+    [[gnu::target("avx2")]] static __m256i Load(const Type* data) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static __m256i Splat(Type value) noexcept {
+        if constexpr (std::is_same_v<Type, float>) return _mm256_castps_si256(_mm256_set1_ps(value));
+        else if constexpr (std::is_same_v<Type, double>) return _mm256_castpd_si256(_mm256_set1_pd(value));
+        else if constexpr (sizeof(Type) == 1) return _mm256_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(Type) == 2) return _mm256_set1_epi16(static_cast<short>(value));
+        else if constexpr (sizeof(Type) == 4) return _mm256_set1_epi32(static_cast<int>(value));
+        else return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    template <typename Type>
+    [[gnu::target("avx2")]] static uint64_t Compare(__m256i lhs, __m256i rhs) noexcept {
+        __m256i equal;
+        if constexpr (std::is_same_v<Type, float>) {
+            equal = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(lhs), _mm256_castsi256_ps(rhs), _CMP_EQ_OQ));
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            equal = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs), _CMP_EQ_OQ));
+        }
+        else if constexpr (sizeof(Type) == 1) equal = _mm256_cmpeq_epi8(lhs, rhs);
+        else if constexpr (sizeof(Type) == 2) equal = _mm256_cmpeq_epi16(lhs, rhs);
+        else if constexpr (sizeof(Type) == 4) equal = _mm256_cmpeq_epi32(lhs, rhs);
+        else equal = _mm256_cmpeq_epi64(lhs, rhs);
+        return static_cast<uint32_t>(_mm256_movemask_epi8(equal));
+    }
+};
+
+//  AVX-512     ,    
+struct Avx512 {
+    static constexpr size_t kBytes = 64;
+    template <typename Type>
+    static constexpr unsigned kMaskBits = 1;
+
+    template <typename Type>
+    [[gnu::target("avx512f,avx512bw")]] static uint64_t EqMask(const Type* lhs, const Type* rhs) noexcept {
+        return Compare<Type>(Load(lhs), Load(rhs));
+    }
+
+    template <typename Type>
+    [[gnu::target("avx512f,avx512bw")]] static uint64_t EqMask(const Type* data, Type value) noexcept {
+        return Compare<Type>(Load(data), Splat(value));
+    }
+
+private:
+    template <typename Type>
+    [[gnu::target("avx512f,avx512bw")]] static __m512i Load(const Type* data) noexcept {
+        return _mm512_loadu_si512(data);
+    }
+
+    template <typename Type>
+    [[gnu::target("avx512f,avx512bw")]] static __m512i Splat(Type value) noexcept {
+        if constexpr (std::is_same_v<Type, float>) return _mm512_castps_si512(_mm512_set1_ps(value));
+        else if constexpr (std::is_same_v<Type, double>) return _mm512_castpd_si512(_mm512_set1_pd(value));
+        else if constexpr (sizeof(Type) == 1) return _mm512_set1_epi8(static_cast<char>(value));
+        else if constexpr (sizeof(Type) == 2) return _mm512_set1_epi16(static_cast<short>(value));
+        else if constexpr (sizeof(Type) == 4) return _mm512_set1_epi32(static_cast<int>(value));
+        else return _mm512_set1_epi64(static_cast<long long>(value));
+    }
+
+    template <typename Type>
+    [[gnu::target("avx512f,avx512bw")]] static uint64_t Compare(__m512i lhs, __m512i rhs) noexcept {
+        if constexpr (std::is_same_v<Type, float>) {
+            return _mm512_cmp_ps_mask(_mm512_castsi512_ps(lhs), _mm512_castsi512_ps(rhs), _CMP_EQ_OQ);
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            return _mm512_cmp_pd_mask(_mm512_castsi512_pd(lhs), _mm512_castsi512_pd(rhs), _CMP_EQ_OQ);
+        }
+        else if constexpr (sizeof(Type) == 1) return _mm512_cmpeq_epi8_mask(lhs, rhs);
+        else if constexpr (sizeof(Type) == 2) return _mm512_cmpeq_epi16_mask(lhs, rhs);
+        else if constexpr (sizeof(Type) == 4) return _mm512_cmpeq_epi32_mask(lhs, rhs);
+        else return _mm512_cmpeq_epi64_mask(lhs, rhs);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>> 
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//        Isa.
+//     target  flatten:      ,
+//  ,        
+
+template <typename Isa, typename Type>
+constexpr uint64_t FullMask() noexcept {
+    constexpr unsigned bits = Isa::kBytes / sizeof(Type) * Isa::template kMaskBits<Type>;
+    return bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+}
+
+template <typename Isa, typename Type>
+size_t MismatchWith(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    constexpr size_t lanes = Isa::kBytes / sizeof(Type);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        uint64_t equal = Isa::EqMask(lhs + i, rhs + i);
+        if (equal != FullMask<Isa, Type>()) {
+            return i + __builtin_ctzll(~equal) / Isa::template kMaskBits<Type>;
+        }
+    }
+    return i + ScalarMismatch(lhs + i, rhs + i, count - i);
+}
+
+template <typename Isa, typename Type>
+size_t FindWith(const Type* data, size_t count, Type value) noexcept {
+    constexpr size_t lanes = Isa::kBytes / sizeof(Type);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        uint64_t equal = Isa::EqMask(data + i, value);
+        if (equal != 0) {
+            return i + __builtin_ctzll(equal) / Isa::template kMaskBits<Type>;
+        }
+    }
+    return i + ScalarFind(data + i, count - i, value);
+}
+
+template <typename Isa, typename Type>
+size_t CountWith(const Type* data, size_t count, Type value) noexcept {
+    constexpr size_t lanes = Isa::kBytes / sizeof(Type);
+    size_t found = 0;
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        found += __builtin_popcountll(Isa::EqMask(data + i, value)) / Isa::template kMaskBits<Type>;
+    }
+    return found + ScalarCount(data + i, count - i, value);
+}
+
+template <typename Type>
+[[gnu::target("sse2"), gnu::flatten]] size_t MismatchSse2(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    return MismatchWith<Sse2>(lhs, rhs, count);
+}
+template <typename Type>
+[[gnu::target("avx2"), gnu::flatten]] size_t MismatchAvx2(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    return MismatchWith<Avx2>(lhs, rhs, count);
+}
+template <typename Type>
+[[gnu::target("avx512f,avx512bw"), gnu::flatten]]
+size_t MismatchAvx512(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    return MismatchWith<Avx512>(lhs, rhs, count);
+}
+
+template <typename Type>
+[[gnu::target("sse2"), gnu::flatten]] size_t FindSse2(const Type* data, size_t count, Type value) noexcept {
+    return FindWith<Sse2>(data, count, value);
+}
+template <typename Type>
+[[gnu::target("avx2"), gnu::flatten]] size_t FindAvx2(const Type* data, size_t count, Type value) noexcept {
+    return FindWith<Avx2>(data, count, value);
+}
+template <typename Type>
+[[gnu::target("avx512f,avx512bw"), gnu::flatten]] size_t FindAvx512(const Type* data, size_t count, Type value) noexcept {
+    return FindWith<Avx512>(data, count, value);
+}
+
+template <typename Type>
+[[gnu::target("sse2,popcnt"), gnu::flatten]] size_t CountSse2(const Type* data, size_t count, Type value) noexcept {
+    return CountWith<Sse2>(data, count, value);
+}
+template <typename Type>
+[[gnu::target("avx2,popcnt"), gnu::flatten]] size_t CountAvx2(const Type* data, size_t count, Type value) noexcept {
+    return CountWith<Avx2>(data, count, value);
+}
+template <typename Type>
+[[gnu::target("avx512f,avx512bw,popcnt"), gnu::flatten]]
+size_t CountAvx512(const Type* data, size_t count, Type value) noexcept {
+    return CountWith<Avx512>(data, count, value);
+}
+
+#endif // SIMPLE_VECTOR_X86_SIMD
+
+inline Level DetectLevel() noexcept {
+#if SIMPLE_VECTOR_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Level::Avx512;
+    if (__builtin_cpu_supports("avx2")) return Level::Avx2;
+    if (__builtin_cpu_supports("sse2")) return Level::Sse2;
+#endif
+    return Level::Scalar;
+}
+
+inline std::atomic<Level>& ActiveLevel() noexcept {
+    static std::atomic<Level> level{DetectLevel()};
+    return level;
+}
+
+} // namespace detail
+
+//   ,   
+inline Level GetSupportedLevel() noexcept {
+    static const Level supported = detail::DetectLevel();
+    return supported;
+}
+
+//  ,    
+inline Level GetLevel() noexcept {
+    return detail::ActiveLevel().load(std::memory_order_relaxed);
+}
+
+//    level,        .
+//     .   
+inline Level SetLevel(Level level) noexcept {
+    if (level > GetSupportedLevel()) {
+        level = GetSupportedLevel();
+    }
+    detail::ActiveLevel().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//      count,   
+template <typename Type>
+size_t Mismatch(const Type* lhs, const Type* rhs, size_t count) noexcept {
+    static_assert(kVectorizable<Type>);
+#if SIMPLE_VECTOR_X86_SIMD
+    switch (GetLevel()) {
+    case Level::Avx512: return detail::MismatchAvx512(lhs, rhs, count);
+    case Level::Avx2: return detail::MismatchAvx2(lhs, rhs, count);
+    case Level::Sse2: return detail::MismatchSse2(lhs, rhs, count);
+    case Level::Scalar: break;
+    }
+#endif
+    return detail::ScalarMismatch(lhs, rhs, count);
+}
+
+template <typename Type>
+bool Equal(const Type* lhs, size_t lhs_count, const Type* rhs, size_t rhs_count) noexcept {
+    return lhs_count == rhs_count && Mismatch(lhs, rhs, lhs_count) == lhs_count;
+}
+
+//  std::lexicographical_compare:   (NaN)  ,
+//      
+template <typename Type>
+bool LexicographicalLess(const Type* lhs, size_t lhs_count, const Type* rhs, size_t rhs_count) noexcept {
+    const size_t common = lhs_count < rhs_count ? lhs_count : rhs_count;
+    size_t i = 0;
+    while (true) {
+        i += Mismatch(lhs + i, rhs + i, common - i);
+        if (i == common) return lhs_count < rhs_count;
+        if (lhs[i] < rhs[i]) return true;
+        if (rhs[i] < lhs[i]) return false;
+        ++i;
+    }
+}
+
+//   ,  value,  count
+template <typename Type>
+size_t Find(const Type* data, size_t count, Type value) noexcept {
+    static_assert(kVectorizable<Type>);
+#if SIMPLE_VECTOR_X86_SIMD
+    switch (GetLevel()) {
+    case Level::Avx512: return detail::FindAvx512(data, count, value);
+    case Level::Avx2: return detail::FindAvx2(data, count, value);
+    case Level::Sse2: return detail::FindSse2(data, count, value);
+    case Level::Scalar: break;
+    }
+#endif
+    return detail::ScalarFind(data, count, value);
+}
+
+template <typename Type>
+size_t Count(const Type* data, size_t count, Type value) noexcept {
+    static_assert(kVectorizable<Type>);
+#if SIMPLE_VECTOR_X86_SIMD
+    switch (GetLevel()) {
+    case Level::Avx512: return detail::CountAvx512(data, count, value);
+    case Level::Avx2: return detail::CountAvx2(data, count, value);
+    case Level::Sse2: return detail::CountSse2(data, count, value);
+    case Level::Scalar: break;
+    }
+#endif
+    return detail::ScalarCount(data, count, value);
+}
+
+} // namespace simd
@@ -1,25 +1,44 @@
 
 #pragma once
 #include <iostream>
+#include <array>
 #include <cassert>
 #include <initializer_list>
 #include <algorithm>
 #include <stdexcept>
 #include <iterator>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include "array_ptr.h"
+#include "growth_policy.h"
+#include "parallel.h"
+#include "simd_kernels.h"
+#include "vector_stats.h"
+
+//   ,  Insert(pos, count, value)    
+template <typename It>
+using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>;
 
 struct ReserveProxyObject {
     size_t reserve;
-    explicit ReserveProxyObject(size_t capacity) : reserve(capacity) {}
+    constexpr explicit ReserveProxyObject(size_t capacity) : reserve(capacity) {}
 };
 
 
-template <typename Type>
-class SimpleVector {
+template <typename Type, typename Allocator = MallocAllocator<Type>, typename GrowthPolicy = GrowByDoubling>
+class SimpleVector : private stats_detail::Recorder<Type> {
+    static constexpr bool kUseSimd = simd::kVectorizable<Type>;
+
 public:
     using Iterator = Type*;
     using ConstIterator = const Type*;
 
+    //      tag.  SIMPLE_VECTOR_STATS   
+    using stats_detail::Recorder<Type>::SetStatsTag;
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///
     ///
@@ -28,28 +47,39 @@ public:
     /// 
     /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SimpleVector() noexcept;
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector() noexcept;
+
+    //   ,    alloc
+    SIMPLE_VECTOR_CONSTEXPR explicit SimpleVector(const Allocator& alloc) noexcept;
 
     //    size ,    
-    explicit SimpleVector(size_t size);
+    SIMPLE_VECTOR_CONSTEXPR explicit SimpleVector(size_t size, const Allocator& alloc = Allocator());
 
     //    size ,   value
-    SimpleVector(size_t size, const Type& value);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator());
+
+    //  ,        policy
+    SimpleVector(size_t size, const Type& value, const ParallelPolicy& policy, const Allocator& alloc = Allocator());
 
     //    std::initializer_list
-    SimpleVector(std::initializer_list<Type> init);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator());
 
     //
-    SimpleVector(const SimpleVector& other);
-    //
-    SimpleVector(SimpleVector&& other);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(const SimpleVector& other);
+    //,      policy
+    SimpleVector(const SimpleVector& other, const ParallelPolicy& policy);
+    //.   other   , other  
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(SimpleVector&& other) noexcept;
+
+    //   [0, now_)
+    SIMPLE_VECTOR_CONSTEXPR ~SimpleVector();
 
-    //
-    SimpleVector& operator=(const SimpleVector& rhs);
-    SimpleVector& operator=(SimpleVector&& rhs);
+    //.   ,    
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector& operator=(const SimpleVector& rhs);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector& operator=(SimpleVector&& rhs) noexcept;
 
     //
-    SimpleVector(ReserveProxyObject obj);
+    SIMPLE_VECTOR_CONSTEXPR SimpleVector(ReserveProxyObject obj, const Allocator& alloc = Allocator());
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///
@@ -60,42 +90,69 @@ public:
     /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
    //     
-    size_t GetSize() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR size_t GetSize() const noexcept {
         return now_;
     }
 
     //   
-    size_t GetCapacity() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR size_t GetCapacity() const noexcept {
         return cap_;
     }
 
     // ,   
-    bool IsEmpty() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR bool IsEmpty() const noexcept {
         return (now_ == 0);
     }
 
+    //       .  SIMPLE_VECTOR_STATS   
+    VectorStats GetStats() const noexcept {
+        VectorStats stats = this->GetRecordedStats();
+        if constexpr (SIMPLE_VECTOR_STATS) {
+            stats.slack = cap_ - now_;
+        }
+        return stats;
+    }
+
+    //   
+    SIMPLE_VECTOR_CONSTEXPR const Allocator& GetAllocator() const noexcept {
+        return main_vector_.GetAllocator();
+    }
+
+    //   ,  
+    static constexpr size_t kDataAlignment = AllocatorAlignment<Allocator>::value;
+
+    //       kDataAlignment.
+    //  AlignedAllocator<Type, 64>   AlignedData()   
+    Type* AlignedData() noexcept {
+        return AssumeAligned<kDataAlignment>(main_vector_.Get());
+    }
+
+    const Type* AlignedData() const noexcept {
+        return AssumeAligned<kDataAlignment>(static_cast<const Type*>(main_vector_.Get()));
+    }
+
     //       index
-    Type& operator[](size_t index) noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Type& operator[](size_t index) noexcept {
         assert(index < now_);
         return main_vector_[index];
     }
 
     //        index
-    const Type& operator[](size_t index) const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR const Type& operator[](size_t index) const noexcept {
         assert(index < now_);
         return main_vector_[index];
     }
 
     //        index
     //   std::out_of_range,  index >= size
-    Type& At(size_t index) {
+    SIMPLE_VECTOR_CONSTEXPR Type& At(size_t index) {
         if (index >= now_) throw std::out_of_range("out of range");
         return main_vector_[index];
     }
 
     //        index
     //   std::out_of_range,  index >= size
-    const Type& At(size_t index) const {
+    SIMPLE_VECTOR_CONSTEXPR const Type& At(size_t index) const {
         if (index >= now_) throw std::out_of_range("out of range");
         return main_vector_[index];
     }
@@ -109,34 +166,87 @@ public:
     /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     //   ,    
-    void Clear() noexcept;
+    SIMPLE_VECTOR_CONSTEXPR void Clear() noexcept;
     //   .
-    //            Type
-    void Resize(size_t new_size);
+    //            Type.
+    //      ,     GrowthPolicy
+    SIMPLE_VECTOR_CONSTEXPR void Resize(size_t new_size);
+    //      policy
+    void Resize(size_t new_size, const ParallelPolicy& policy);
+
+    //  Resize,      :
+    //    (char, int, ...)   
+    //     ,  read()   
+    void ResizeForOverwrite(size_t new_size);
 
     //     
-    void swap(SimpleVector& other) noexcept;
+    SIMPLE_VECTOR_CONSTEXPR void swap(SimpleVector& other) noexcept;
 
     //     
-    //       
-    void PushBack(const Type& item);
-    void PushBack(Type&& item);
+    //       GrowthPolicy (  )
+    SIMPLE_VECTOR_CONSTEXPR void PushBack(const Type& item);
+    SIMPLE_VECTOR_CONSTEXPR void PushBack(Type&& item);
 
     //   value   pos.
     //     
     //        ,
-    //     ,     0   1
-    Iterator Insert(ConstIterator pos, const Type& value);
-    Type* Insert(ConstIterator pos, Type&& value);
+    //     GrowthPolicy:   ,     0   1
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, const Type& value);
+    SIMPLE_VECTOR_CONSTEXPR Type* Insert(ConstIterator pos, Type&& value);
+
+    //    [first, last)   pos.
+    //      ,    .
+    //       
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, InputIt first, InputIt last);
+
+    //  count  value   pos
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, size_t count, const Type& value);
+
+    //      pos
+    SIMPLE_VECTOR_CONSTEXPR Iterator Insert(ConstIterator pos, std::initializer_list<Type> init);
+
+    //    [first, last)   .
+    //         
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SIMPLE_VECTOR_CONSTEXPR void Append(InputIt first, InputIt last);
+
+    //    args       .
+    //     
+    template <typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR Type& EmplaceBack(Args&&... args);
+
+    //    args   pos.
+    //     
+    template <typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR Iterator Emplace(ConstIterator pos, Args&&... args);
 
     // ""   .     
-    void PopBack() noexcept;
+    SIMPLE_VECTOR_CONSTEXPR void PopBack() noexcept;
 
     //      
-    Iterator Erase(ConstIterator pos);
+    SIMPLE_VECTOR_CONSTEXPR Iterator Erase(ConstIterator pos);
+
+    //   [first, last)   .    ,    first
+    SIMPLE_VECTOR_CONSTEXPR Iterator Erase(ConstIterator first, ConstIterator last);
+
+    //   ,   pred  true,      .
+    //   
+    template <typename Predicate>
+    SIMPLE_VECTOR_CONSTEXPR size_t EraseIf(Predicate pred);
+
+    //    O(1),     .    .
+    //       end(),   
+    SIMPLE_VECTOR_CONSTEXPR Iterator SwapErase(ConstIterator pos);
 
     //   n_c 
-    void Reserve(size_t new_capacity);
+    SIMPLE_VECTOR_CONSTEXPR void Reserve(size_t new_capacity);
+    //      ,     policy.
+    //      reallocate   ,   Reserve
+    void Reserve(size_t new_capacity, const ParallelPolicy& policy);
+
+    //    ,    
+    SIMPLE_VECTOR_CONSTEXPR void ShrinkToFit();
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///
@@ -148,37 +258,37 @@ public:
 
    //     
    //       (  ) nullptr
-    Iterator begin() noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Iterator begin() noexcept {
         return main_vector_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    Iterator end() noexcept {
+    SIMPLE_VECTOR_CONSTEXPR Iterator end() noexcept {
         return  main_vector_.Get() + now_;
     }
 
     //      
     //       (  ) nullptr
-    ConstIterator begin() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator begin() const noexcept {
         return  main_vector_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    ConstIterator end() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator end() const noexcept {
         return main_vector_.Get() + now_;
     }
 
     //      
     //       (  ) nullptr
-    ConstIterator cbegin() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator cbegin() const noexcept {
         return  main_vector_.Get();
     }
 
     //    ,   
     //       (  ) nullptr
-    ConstIterator cend() const noexcept {
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator cend() const noexcept {
         return main_vector_.Get() + now_;
     }
 
@@ -190,30 +300,76 @@ public:
     /// 
     /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool operator==(const SimpleVector<Type>& rhs) {
-        return  (std::equal(this->begin(), this->end(), rhs.begin()) && this->now_ == rhs.now_);
+    //        simd_kernels.h,
+    //    -  
+    SIMPLE_VECTOR_CONSTEXPR bool operator==(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        if constexpr (kUseSimd) {
+            if (!IsConstantEvaluated()) {
+                return simd::Equal(begin(), now_, rhs.begin(), rhs.now_);
+            }
+        }
+        return now_ == rhs.now_ && std::equal(begin(), end(), rhs.begin());
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR bool operator!=(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        return !(*this == rhs);
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR bool operator<(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        if constexpr (kUseSimd) {
+            if (!IsConstantEvaluated()) {
+                return simd::LexicographicalLess(begin(), now_, rhs.begin(), rhs.now_);
+            }
+        }
+        return std::lexicographical_compare(begin(), end(), rhs.begin(), rhs.end());
     }
 
-    bool operator!=(const SimpleVector<Type>& rhs) {
-        return  !(std::equal(this->begin(), this->end(), rhs.begin()) && this->now_ == rhs.now_);
+    SIMPLE_VECTOR_CONSTEXPR bool operator<=(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        return !(rhs < *this);
     }
 
-    bool operator<(const SimpleVector<Type>& rhs) {
-        return (std::lexicographical_compare(this->cbegin(), this->cend(), rhs.cbegin(), rhs.cend()));
+    SIMPLE_VECTOR_CONSTEXPR bool operator>(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        return rhs < *this;
     }
 
-    bool operator<=(const SimpleVector<Type>& rhs) {
-        if (*this < rhs || *this == rhs)return true;
-        return false;
+    SIMPLE_VECTOR_CONSTEXPR bool operator>=(const SimpleVector& rhs) const noexcept(kUseSimd) {
+        return !(*this < rhs);
     }
 
-    bool operator>(const SimpleVector<Type>& rhs) {
-        return (std::lexicographical_compare(this->cbegin(), this->cend(), rhs.cbegin(), rhs.cend()));
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    /// 
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //     ,  value,  end()
+    SIMPLE_VECTOR_CONSTEXPR Iterator Find(const Type& value) {
+        return const_cast<Iterator>(std::as_const(*this).Find(value));
     }
 
-    bool operator>=(const SimpleVector<Type>& rhs) {
-        if (*this > rhs || *this == rhs)return true;
-        return false;
+    SIMPLE_VECTOR_CONSTEXPR ConstIterator Find(const Type& value) const {
+        if constexpr (kUseSimd) {
+            if (!IsConstantEvaluated()) {
+                return begin() + simd::Find(begin(), now_, value);
+            }
+        }
+        return std::find(begin(), end(), value);
+    }
+
+    //  ,  value
+    SIMPLE_VECTOR_CONSTEXPR size_t Count(const Type& value) const {
+        if constexpr (kUseSimd) {
+            if (!IsConstantEvaluated()) {
+                return simd::Count(begin(), now_, value);
+            }
+        }
+        return static_cast<size_t>(std::count(begin(), end(), value));
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR bool Contains(const Type& value) const {
+        return Find(value) != end();
     }
 
 
@@ -221,14 +377,35 @@ private:
 
     size_t now_ = 0;
     size_t cap_ = 0;
-    ArrayPtr<Type> main_vector_;
+    ArrayPtr<Type, Allocator> main_vector_;
 
-    //           cap_
-    void RepeatPatternPushback();
+    // ,         cap_     
+    template<typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR void RepeatPatternPushback(Args&&... args);
 
     //           cap_   
-    template<typename Value>
-    void RepeatPatternInsert(size_t elem_num, Iterator constcasted, Value& value);
+    template<typename... Args>
+    SIMPLE_VECTOR_CONSTEXPR void RepeatPatternInsert(size_t elem_num, Iterator constcasted, Args&&... args);
+
+    //   new_size ,     GrowthPolicy
+    SIMPLE_VECTOR_CONSTEXPR void GrowForResize(size_t new_size);
+
+    // count    elem_num     construct(Type* dest)
+    template<typename Construct>
+    SIMPLE_VECTOR_CONSTEXPR Iterator InsertN(size_t elem_num, size_t count, Construct construct);
+
+    //  [elem_num, now_)  count  ,      
+    SIMPLE_VECTOR_CONSTEXPR void ShiftTail(size_t elem_num, size_t count);
+
+    // ,  ShiftTail,   
+    SIMPLE_VECTOR_CONSTEXPR void UnshiftTail(size_t elem_num, size_t count) noexcept;
+
+    //      new_cap .
+    //     realloc/memcpy
+    SIMPLE_VECTOR_CONSTEXPR void Reallocate(size_t new_cap);
+
+    //  [first, last)    dest   
+    static SIMPLE_VECTOR_CONSTEXPR void Relocate(Iterator first, Iterator last, Iterator dest);
 
 
 };
@@ -239,10 +416,31 @@ private:
 //                                                                                                      //
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-ReserveProxyObject Reserve(size_t capacity_to_reserve) {
+constexpr ReserveProxyObject Reserve(size_t capacity_to_reserve) {
     return ReserveProxyObject(capacity_to_reserve);
 }
 
+#if SIMPLE_VECTOR_HAS_CONSTEXPR
+//  ,    ,  std::array   .
+// build -   ,  SimpleVector.   :     .
+//     constexpr auto kSquares = FreezeToArray([] {
+//         SimpleVector<uint32_t> table;
+//         for (uint32_t i = 0; i < 256; ++i) table.PushBack(i * i);
+//         return table;
+//     });
+//           
+template <typename Build>
+constexpr auto FreezeToArray(Build) {
+    using Vector = decltype(Build{}());
+    using Value = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<const Vector&>().begin())>>;
+    constexpr size_t size = Build{}().GetSize();
+    std::array<Value, size> result{};
+    Vector vector = Build{}();
+    std::copy(vector.begin(), vector.end(), result.begin());
+    return result;
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///
 ///
@@ -251,54 +449,125 @@ ReserveProxyObject Reserve(size_t capacity_to_reserve) {
 /// 
 /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector() noexcept = default;
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector() noexcept = default;
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(const Allocator& alloc) noexcept : main_vector_(alloc) {
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(size_t size, const Allocator& alloc) : now_(size), cap_(size), main_vector_(alloc)  {
+    this->RecordAllocation(0, size, 0);
+    if constexpr (IsZeroInitializable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            //   calloc/mmap,    
+            main_vector_ = ArrayPtr<Type, Allocator>::AllocateZeroed(size, alloc);
+            return;
+        }
+    }
+    ArrayPtr<Type, Allocator> ptr(size, alloc);
+    main_vector_.swap(ptr);
+    array_detail::UninitializedValueConstruct(begin(), end());
+}
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(size_t size) : now_(size), cap_(size), main_vector_(size)  {
-    std::fill(begin(), end(), 0);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(size_t size, const Type& value, const Allocator& alloc) : now_(size), cap_(size), main_vector_(size, alloc) {
+    this->RecordAllocation(0, size, 0);
+    array_detail::UninitializedFill(begin(), end(), value);
 }
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(size_t size, const Type& value) : now_(size), cap_(size), main_vector_(size) {
-    std::fill(begin(), end(), value);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(size_t size, const Type& value, const ParallelPolicy& policy, const Allocator& alloc) : main_vector_(size, alloc) {
+    Iterator data = begin();
+    parallel_detail::ParallelConstruct(size, sizeof(Type), policy,
+        [data, &value](size_t first, size_t last) { std::uninitialized_fill(data + first, data + last, value); },
+        [data](size_t first, size_t last) { std::destroy(data + first, data + last); });
+    now_ = cap_ = size;
+    this->RecordAllocation(0, size, 0);
 }
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(std::initializer_list<Type> init) : now_(init.size()), cap_(init.size()), main_vector_(init.size()) {
-    std::move(init.begin(), init.end(), begin());
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(std::initializer_list<Type> init, const Allocator& alloc) : now_(init.size()), cap_(init.size()), main_vector_(init.size(), alloc) {
+    this->RecordAllocation(0, init.size(), 0);
+    array_detail::UninitializedCopy(init.begin(), init.end(), begin());
 }
 
 
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(const SimpleVector& other) : now_(other.now_), cap_(other.cap_), main_vector_(now_) {
-    std::copy(other.begin(), other.end(), begin());
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(const SimpleVector& other)
+    : stats_detail::Recorder<Type>(), now_(other.now_), cap_(other.now_),
+    main_vector_(now_, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.GetAllocator())) {
+    this->RecordAllocation(0, now_, 0);
+    array_detail::UninitializedCopy(other.begin(), other.end(), begin());
 }
 
-template <typename Type>
-SimpleVector<Type>& SimpleVector<Type>::operator=(const SimpleVector<Type>& rhs) {
-    if (*this == rhs) return *this;
-    SimpleVector<Type> temp(rhs);
-    this->swap(temp);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(const SimpleVector& other, const ParallelPolicy& policy)
+    : main_vector_(other.now_, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.GetAllocator())) {
+    ConstIterator from = other.begin();
+    Iterator to = begin();
+    parallel_detail::ParallelConstruct(other.now_, sizeof(Type), policy,
+        [from, to](size_t first, size_t last) { std::uninitialized_copy(from + first, from + last, to + first); },
+        [to](size_t first, size_t last) { std::destroy(to + first, to + last); });
+    now_ = cap_ = other.now_;
+    this->RecordAllocation(0, now_, 0);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>& SimpleVector<Type, Allocator, GrowthPolicy>::operator=(const SimpleVector<Type, Allocator, GrowthPolicy>& rhs) {
+    if (this == &rhs) return *this;
+    if (rhs.now_ > cap_) {
+        Clear();
+        ArrayPtr<Type, Allocator> ptr(rhs.now_, GetAllocator());
+        main_vector_.swap(ptr);
+        this->RecordAllocation(cap_, rhs.now_, 0);
+        cap_ = rhs.now_;
+        array_detail::UninitializedCopy(rhs.begin(), rhs.end(), begin());
+    }
+    else if (std::is_trivially_copyable_v<Type> && !IsConstantEvaluated()) {
+        if (rhs.now_ > 0) {
+            std::memcpy(static_cast<void*>(begin()), rhs.begin(), rhs.now_ * sizeof(Type));
+        }
+    }
+    else {
+        //  ,  ,  
+        size_t common = std::min(now_, rhs.now_);
+        std::copy(rhs.begin(), rhs.begin() + common, begin());
+        if (rhs.now_ > now_) {
+            array_detail::UninitializedCopy(rhs.begin() + common, rhs.end(), end());
+        }
+        else {
+            std::destroy(begin() + common, end());
+        }
+    }
+    now_ = rhs.now_;
     return *this;
 }
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(ReserveProxyObject obj) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(ReserveProxyObject obj, const Allocator& alloc) : main_vector_(alloc) {
     Reserve(obj.reserve);
 }
 
-template <typename Type>
-SimpleVector<Type>::SimpleVector(SimpleVector&& other) : main_vector_(other.GetSize()) {
-    if (this == &other) return;
-    swap(other);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::SimpleVector(SimpleVector&& other) noexcept
+    : stats_detail::Recorder<Type>(std::move(other)), now_(std::exchange(other.now_, 0)), cap_(std::exchange(other.cap_, 0)),
+      main_vector_(std::move(other.main_vector_)) {
 }
 
-template <typename Type>
-SimpleVector<Type>& SimpleVector<Type>::operator=(SimpleVector<Type>&& rhs) {
-    if (*this == rhs) return *this;
-    SimpleVector<Type> temp(rhs);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>::~SimpleVector() {
+    this->RecordDestruction(cap_ - now_, cap_);
+    std::destroy(begin(), end());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR SimpleVector<Type, Allocator, GrowthPolicy>& SimpleVector<Type, Allocator, GrowthPolicy>::operator=(SimpleVector<Type, Allocator, GrowthPolicy>&& rhs) noexcept {
+    if (this == &rhs) return *this;
+    //           
+    SimpleVector temp(std::move(rhs));
     this->swap(temp);
     return *this;
 }
@@ -313,116 +582,273 @@ SimpleVector<Type>& SimpleVector<Type>::operator=(SimpleVector<Type>&& rhs) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
-template <typename Type>
-void SimpleVector<Type>::Clear() noexcept {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Clear() noexcept {
+    std::destroy(begin(), end());
     now_ = 0;
 }
 
-template <typename Type>
-void SimpleVector<Type>::swap(SimpleVector& other) noexcept {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::swap(SimpleVector& other) noexcept {
     main_vector_.swap(other.main_vector_);
     std::swap(this->cap_, other.cap_);
     std::swap(this->now_, other.now_);
+    this->SwapRecorded(other);
 }
 
-template <typename Type>
-void SimpleVector<Type>::PushBack(const Type& item) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::PushBack(const Type& item) {
+    EmplaceBack(item);
+}
 
-    if (now_ >= cap_) {
-        RepeatPatternPushback();
-    }
-    main_vector_[now_] = item;
-    ++now_;
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::PushBack(Type&& item) {
+    EmplaceBack(std::move(item));
 }
 
-template <typename Type>
-void SimpleVector<Type>::PushBack(Type&& item) {
-    if (now_ >= cap_) {
-        RepeatPatternPushback();
-    }
-    main_vector_[now_] = std::move(item);
-    ++now_;
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, const Type& value) {
+    return Emplace(pos, value);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, Type&& value) {
+    return Emplace(pos, std::move(value));
 }
 
-template <typename Type>
-Type* SimpleVector<Type>::Insert(ConstIterator pos, const Type& value) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename InputIt, typename>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, InputIt first, InputIt last) {
     assert(pos >= begin() && pos <= end());
-    Iterator constcasted = const_cast<Iterator>(&*pos);
     size_t elem_num = std::distance(cbegin(), pos);
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_convertible_v<Category, std::forward_iterator_tag>) {
+        size_t count = std::distance(first, last);
+        return InsertN(elem_num, count, [&first, count](Type* dest) {
+            array_detail::UninitializedCopyN(first, count, dest);
+        });
+    }
+    else {
+        //    
+        SimpleVector buffer(GetAllocator());
+        buffer.Append(first, last);
+        return Insert(pos, std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, size_t count, const Type& value) {
+    assert(pos >= begin() && pos <= end());
+    //value      
+    const Type copy(value);
+    return InsertN(std::distance(cbegin(), pos), count, [&copy, count](Type* dest) {
+        array_detail::UninitializedFill(dest, dest + count, copy);
+    });
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Insert(ConstIterator pos, std::initializer_list<Type> init) {
+    return Insert(pos, init.begin(), init.end());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename InputIt, typename>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Append(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_convertible_v<Category, std::forward_iterator_tag>) {
+        Insert(cend(), first, last);
+    }
+    else {
+        for (; first != last; ++first) {
+            EmplaceBack(*first);
+        }
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+SIMPLE_VECTOR_CONSTEXPR Type& SimpleVector<Type, Allocator, GrowthPolicy>::EmplaceBack(Args&&... args) {
     if (now_ >= cap_) {
-        RepeatPatternInsert(elem_num, constcasted, Type(value));
+        RepeatPatternPushback(std::forward<Args>(args)...);
     }
     else {
-        std::move(pos, cend(), constcasted + 1);
-        main_vector_[elem_num] = value;
+        array_detail::ConstructAt(end(), std::forward<Args>(args)...);
     }
     ++now_;
-    return Iterator(main_vector_.Get() + elem_num);
+    return *(end() - 1);
 }
 
-template <typename Type>
-Type* SimpleVector<Type>::Insert(ConstIterator pos, Type&& value) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Emplace(ConstIterator pos, Args&&... args) {
     assert(pos >= begin() && pos <= end());
     Iterator constcasted = const_cast<Iterator>(&*pos);
     size_t elem_num = std::distance(cbegin(), pos);
 
     if (now_ >= cap_) {
-        RepeatPatternInsert(elem_num, constcasted, value);
+        RepeatPatternInsert(elem_num, constcasted, std::forward<Args>(args)...);
+    }
+    else if (constcasted == end()) {
+        array_detail::ConstructAt(end(), std::forward<Args>(args)...);
     }
     else {
-        std::move(constcasted, end(), constcasted + 1);
-        main_vector_[elem_num] = std::move(value);
+        //      ,     
+        Type item(std::forward<Args>(args)...);
+        array_detail::ConstructAt(end(), std::move(*(end() - 1)));
+        std::move_backward(constcasted, end() - 1, end());
+        *constcasted = std::move(item);
     }
     ++now_;
     return Iterator(main_vector_.Get() + elem_num);
 }
 
-template <typename Type>
-void SimpleVector<Type>::PopBack() noexcept {
-    if (now_ > 0) --now_;
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::PopBack() noexcept {
+    if (now_ > 0) {
+        --now_;
+        std::destroy_at(end());
+    }
 }
 
-template <typename Type>
-Type* SimpleVector<Type>::Erase(const Type* pos) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Erase(const Type* pos) {
     assert(pos >= begin() && pos <= end());
     if (now_ > 0) {
         Iterator constcasted = const_cast<Iterator>(&*pos);
         std::move(constcasted + 1, end(), constcasted);
         --now_;
+        std::destroy_at(end());
         return constcasted;
     }
     return nullptr;
 }
 
-template <typename Type>
-void SimpleVector<Type>::Reserve(size_t new_capacity) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::Erase(ConstIterator first, ConstIterator last) {
+    assert(begin() <= first && first <= last && last <= end());
+    Iterator from = const_cast<Iterator>(first);
+    Iterator to = const_cast<Iterator>(last);
+    if (from == to) {
+        return from;
+    }
+    size_t count = to - from;
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            // ,    memmove
+            std::destroy(from, to);
+            if (to != end()) {
+                std::memmove(static_cast<void*>(from), to, (end() - to) * sizeof(Type));
+            }
+            now_ -= count;
+            return from;
+        }
+    }
+    std::move(to, end(), from);
+    std::destroy(end() - count, end());
+    now_ -= count;
+    return from;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template <typename Predicate>
+SIMPLE_VECTOR_CONSTEXPR size_t SimpleVector<Type, Allocator, GrowthPolicy>::EraseIf(Predicate pred) {
+    Iterator new_end = std::remove_if(begin(), end(), pred);
+    size_t count = end() - new_end;
+    std::destroy(new_end, end());
+    now_ -= count;
+    return count;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::SwapErase(ConstIterator pos) {
+    assert(begin() <= pos && pos < end());
+    Iterator hole = const_cast<Iterator>(pos);
+    Iterator last = end() - 1;
+    if (hole != last) {
+        *hole = std::move(*last);
+    }
+    PopBack();
+    return hole;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Reserve(size_t new_capacity) {
     if (new_capacity > this->cap_) {
-        ArrayPtr<Type> ptr(new_capacity);
-        std::move(begin(), end(), ptr.Get());
+        Reallocate(new_capacity);
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void SimpleVector<Type, Allocator, GrowthPolicy>::Reserve(size_t new_capacity, const ParallelPolicy& policy) {
+    if (new_capacity <= cap_) {
+        return;
+    }
+    constexpr bool relocatable = IsTriviallyRelocatable<Type>::value;
+    if constexpr ((relocatable && AllocatorHasReallocate<Allocator>::value)
+                  || (!relocatable && !std::is_nothrow_move_constructible_v<Type>)) {
+        //realloc/mremap   ,       
+        Reallocate(new_capacity);
+    }
+    else {
+        ArrayPtr<Type, Allocator> ptr(new_capacity, GetAllocator());
+        Iterator from = begin();
+        Iterator to = ptr.Get();
+        parallel_detail::ParallelConstruct(now_, sizeof(Type), policy,
+            [from, to](size_t first, size_t last) { Relocate(from + first, from + last, to + first); },
+            [](size_t, size_t) {});
         main_vector_.swap(ptr);
-        this->cap_ = new_capacity;
+        this->RecordAllocation(cap_, new_capacity, now_);
+        cap_ = new_capacity;
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::ShrinkToFit() {
+    if (cap_ > now_) {
+        Reallocate(now_);
     }
 }
 
-template <typename Type>
-void SimpleVector<Type>::Resize(size_t new_size) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Resize(size_t new_size) {
     if (new_size < now_) {
+        std::destroy(begin() + new_size, end());
         now_ = new_size;
     }
 
     else {
-        //Type* dynamic_arr = new Type[new_size];
-        ArrayPtr<Type> ptr(new_size);
-        for (size_t i = 0; i < new_size; ++i) {
-            ptr[i] = std::move(Type());
-        }
-        std::move(begin(), end(), ptr.Get());
-        main_vector_.swap(ptr);
+        GrowForResize(new_size);
+        array_detail::UninitializedValueConstruct(end(), begin() + new_size);
         now_ = new_size;
-        cap_ = new_size;
     }
 }
 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void SimpleVector<Type, Allocator, GrowthPolicy>::Resize(size_t new_size, const ParallelPolicy& policy) {
+    if (new_size <= now_) {
+        Resize(new_size);
+        return;
+    }
+    GrowForResize(new_size);
+    Iterator tail = end();
+    parallel_detail::ParallelConstruct(new_size - now_, sizeof(Type), policy,
+        [tail](size_t first, size_t last) { std::uninitialized_value_construct(tail + first, tail + last); },
+        [tail](size_t first, size_t last) { std::destroy(tail + first, tail + last); });
+    now_ = new_size;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void SimpleVector<Type, Allocator, GrowthPolicy>::ResizeForOverwrite(size_t new_size) {
+    if (new_size < now_) {
+        std::destroy(begin() + new_size, end());
+    }
+    else {
+        GrowForResize(new_size);
+        std::uninitialized_default_construct(end(), begin() + new_size);
+    }
+    now_ = new_size;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///
 ///
@@ -432,26 +858,164 @@ void SimpleVector<Type>::Resize(size_t new_size) {
 /// 
 /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename Type>
-template<typename Value>
-void SimpleVector<Type>::RepeatPatternInsert(size_t elem_num, Type* constcasted, Value& value) {
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template<typename... Args>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::RepeatPatternInsert(size_t elem_num, Type* constcasted, Args&&... args) {
+
+    size_t new_cap = GrowthPolicy::Grow(cap_, now_ + 1, sizeof(Type));
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        //realloc   ,       
+        Type item(std::forward<Args>(args)...);
+        Reallocate(new_cap);
+        ShiftTail(elem_num, 1);
+        array_detail::ConstructAt(begin() + elem_num, std::move(item));
+    }
+    else {
+        ArrayPtr<Type, Allocator> ptr(new_cap, GetAllocator());
+        //   :      
+        array_detail::ConstructAt(ptr.Get() + elem_num, std::forward<Args>(args)...);
+        Relocate(begin(), constcasted, ptr.Get());
+        Relocate(constcasted, end(), ptr.Get() + elem_num + 1);
+        main_vector_.swap(ptr);
+        this->RecordAllocation(cap_, new_cap, now_);
+        cap_ = new_cap;
+    }
+}
 
-    if (cap_ > 0)cap_ *= 2;
-    else cap_ = 1;
-    ArrayPtr<Type> ptr(cap_);
-    std::move(begin(), constcasted, ptr.Get());
-    ptr[elem_num] = std::move(value);
-    std::move(constcasted, end(), ptr.Get() + elem_num + 1);
-    main_vector_.swap(ptr);
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template<typename... Args>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::RepeatPatternPushback(Args&&... args) {
+    size_t new_cap = GrowthPolicy::Grow(cap_, now_ + 1, sizeof(Type));
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        //realloc   ,       
+        Type item(std::forward<Args>(args)...);
+        Reallocate(new_cap);
+        array_detail::ConstructAt(end(), std::move(item));
+    }
+    else {
+        ArrayPtr<Type, Allocator> ptr(new_cap, GetAllocator());
+        //   :      
+        array_detail::ConstructAt(ptr.Get() + now_, std::forward<Args>(args)...);
+        Relocate(begin(), end(), ptr.Get());
+        main_vector_.swap(ptr);
+        this->RecordAllocation(cap_, new_cap, now_);
+        cap_ = new_cap;
+    }
 }
 
+template <typename Type, typename Allocator, typename GrowthPolicy>
+template<typename Construct>
+SIMPLE_VECTOR_CONSTEXPR Type* SimpleVector<Type, Allocator, GrowthPolicy>::InsertN(size_t elem_num, size_t count, Construct construct) {
+    if (count == 0) {
+        return begin() + elem_num;
+    }
+    //   ,        .
+    //           
+    constexpr bool kShiftInPlace = IsTriviallyRelocatable<Type>::value || std::is_nothrow_move_constructible_v<Type>;
+    if (now_ + count > cap_ || !kShiftInPlace) {
+        size_t new_cap = now_ + count > cap_ ? GrowthPolicy::Grow(cap_, now_ + count, sizeof(Type)) : cap_;
+        if constexpr (!IsTriviallyRelocatable<Type>::value) {
+            //     :   construct   
+            ArrayPtr<Type, Allocator> ptr(new_cap, GetAllocator());
+            construct(ptr.Get() + elem_num);
+            Relocate(begin(), begin() + elem_num, ptr.Get());
+            Relocate(begin() + elem_num, end(), ptr.Get() + elem_num + count);
+            main_vector_.swap(ptr);
+            this->RecordAllocation(cap_, new_cap, now_);
+            cap_ = new_cap;
+            now_ += count;
+            return begin() + elem_num;
+        }
+        else {
+            Reallocate(new_cap);
+        }
+    }
+    ShiftTail(elem_num, count);
+    try {
+        construct(begin() + elem_num);
+    } catch (...) {
+        //construct     ,      
+        UnshiftTail(elem_num, count);
+        throw;
+    }
+    now_ += count;
+    return begin() + elem_num;
+}
 
-template<typename Type>
-void SimpleVector<Type>::RepeatPatternPushback() {
-    if (cap_ > 0)cap_ *= 2;
-    else cap_ = 1;
-    ArrayPtr<Type> ptr(cap_);
-    std::move(begin(), end(), ptr.Get());
-    main_vector_.swap(ptr);
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::GrowForResize(size_t new_size) {
+    if (new_size > cap_) {
+        Reallocate(GrowthPolicy::Grow(cap_, new_size, sizeof(Type)));
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::ShiftTail(size_t elem_num, size_t count) {
+    Iterator data = begin();
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            if (elem_num < now_) {
+                std::memmove(static_cast<void*>(data + elem_num + count), data + elem_num, (now_ - elem_num) * sizeof(Type));
+            }
+            return;
+        }
+    }
+    //  :     ,   
+    for (Iterator from = data + now_; from != data + elem_num;) {
+        --from;
+        array_detail::ConstructAt(from + count, std::move(*from));
+        std::destroy_at(from);
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::UnshiftTail(size_t elem_num, size_t count) noexcept {
+    Iterator data = begin();
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            if (elem_num < now_) {
+                std::memmove(static_cast<void*>(data + elem_num), data + elem_num + count, (now_ - elem_num) * sizeof(Type));
+            }
+            return;
+        }
+    }
+    //  :       
+    for (Iterator to = data + elem_num; to != data + now_; ++to) {
+        array_detail::ConstructAt(to, std::move(*(to + count)));
+        std::destroy_at(to + count);
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Reallocate(size_t new_cap) {
+    bool relocated = false;
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            main_vector_.Reallocate(new_cap, now_);
+            relocated = true;
+        }
+    }
+    if (!relocated) {
+        ArrayPtr<Type, Allocator> ptr(new_cap, GetAllocator());
+        Relocate(begin(), end(), ptr.Get());
+        main_vector_.swap(ptr);
+    }
+    this->RecordAllocation(cap_, new_cap, now_);
+    cap_ = new_cap;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+SIMPLE_VECTOR_CONSTEXPR void SimpleVector<Type, Allocator, GrowthPolicy>::Relocate(Iterator first, Iterator last, Iterator dest) {
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (!IsConstantEvaluated()) {
+            if (first != last) {
+                std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(Type));
+            }
+            return;
+        }
+    }
+    array_detail::UninitializedMove(first, last, dest);
+    std::destroy(first, last);
 }
 
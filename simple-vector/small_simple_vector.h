@@ -0,0 +1,539 @@
+#pragma once
+#include <cassert>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <iterator>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include "array_ptr.h"
+#include "simple_vector.h"
+
+
+//    :  N     ,
+//   (ArrayPtr)      N.
+//   SimpleVector
+template <typename Type, size_t N, typename Allocator = MallocAllocator<Type>>
+class SmallSimpleVector {
+    static_assert(N > 0, "inline capacity must be positive");
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SmallSimpleVector() noexcept;
+
+    //   ,      alloc
+    explicit SmallSimpleVector(const Allocator& alloc) noexcept;
+
+    //    size ,    
+    explicit SmallSimpleVector(size_t size, const Allocator& alloc = Allocator());
+
+    //    size ,   value
+    SmallSimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator());
+
+    //    std::initializer_list
+    SmallSimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator());
+
+    //
+    SmallSimpleVector(ReserveProxyObject obj, const Allocator& alloc = Allocator());
+
+    //
+    SmallSimpleVector(const SmallSimpleVector& other);
+    //.     ,   
+    SmallSimpleVector(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    //   [0, now_)
+    ~SmallSimpleVector();
+
+    //
+    SmallSimpleVector& operator=(const SmallSimpleVector& rhs);
+    SmallSimpleVector& operator=(SmallSimpleVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //     
+    size_t GetSize() const noexcept {
+        return now_;
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return cap_;
+    }
+
+    // ,   
+    bool IsEmpty() const noexcept {
+        return (now_ == 0);
+    }
+
+    // ,      
+    bool IsInline() const noexcept {
+        return !heap_;
+    }
+
+    //  ,     
+    const Allocator& GetAllocator() const noexcept {
+        return heap_.GetAllocator();
+    }
+
+    //       index
+    Type& operator[](size_t index) noexcept {
+        assert(index < now_);
+        return Data()[index];
+    }
+
+    //        index
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < now_);
+        return Data()[index];
+    }
+
+    //       index
+    //   std::out_of_range,  index >= size
+    Type& At(size_t index) {
+        if (index >= now_) throw std::out_of_range("out of range");
+        return Data()[index];
+    }
+
+    //        index
+    //   std::out_of_range,  index >= size
+    const Type& At(size_t index) const {
+        if (index >= now_) throw std::out_of_range("out of range");
+        return Data()[index];
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //   ,    
+    void Clear() noexcept;
+
+    //   .
+    //            Type
+    void Resize(size_t new_size);
+
+    //     .
+    //     ,   - 
+    void swap(SmallSimpleVector& other) noexcept(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_swappable_v<Type>);
+
+    //     
+    //         
+    void PushBack(const Type& item);
+    void PushBack(Type&& item);
+
+    //   value   pos.
+    //     
+    Iterator Insert(ConstIterator pos, const Type& value);
+    Iterator Insert(ConstIterator pos, Type&& value);
+
+    //    args        
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args);
+
+    //    args   pos     
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args);
+
+    // ""   .     
+    void PopBack() noexcept;
+
+    //      
+    Iterator Erase(ConstIterator pos);
+
+    //   new_capacity 
+    void Reserve(size_t new_capacity);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Iterator begin() noexcept {
+        return Data();
+    }
+
+    Iterator end() noexcept {
+        return Data() + now_;
+    }
+
+    ConstIterator begin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator end() const noexcept {
+        return Data() + now_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator cend() const noexcept {
+        return Data() + now_;
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>> 
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool operator==(const SmallSimpleVector& rhs) const {
+        return now_ == rhs.now_ && std::equal(cbegin(), cend(), rhs.cbegin());
+    }
+
+    bool operator!=(const SmallSimpleVector& rhs) const {
+        return !(*this == rhs);
+    }
+
+    bool operator<(const SmallSimpleVector& rhs) const {
+        return std::lexicographical_compare(cbegin(), cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    bool operator<=(const SmallSimpleVector& rhs) const {
+        return !(rhs < *this);
+    }
+
+    bool operator>(const SmallSimpleVector& rhs) const {
+        return rhs < *this;
+    }
+
+    bool operator>=(const SmallSimpleVector& rhs) const {
+        return !(*this < rhs);
+    }
+
+private:
+
+    size_t now_ = 0;
+    size_t cap_ = N;
+    ArrayPtr<Type, Allocator> heap_;
+    alignas(Type) unsigned char inline_[N * sizeof(Type)];
+
+    Type* Data() noexcept {
+        return heap_ ? heap_.Get() : reinterpret_cast<Type*>(inline_);
+    }
+
+    const Type* Data() const noexcept {
+        return heap_ ? heap_.Get() : reinterpret_cast<const Type*>(inline_);
+    }
+
+    //     new_cap 
+    void Reallocate(size_t new_cap);
+
+    //       elem_num,  
+    template<typename... Args>
+    void RepeatPatternInsert(size_t elem_num, Args&&... args);
+
+    //  other,     
+    void StealFrom(SmallSimpleVector& other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    //  [first, last)    dest   
+    static void Relocate(Iterator first, Iterator last, Iterator dest);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                                      //
+///////////////////////////////// /////////////////////////////////////////////////////////////
+//                                                                                                      //
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector() noexcept {
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(const Allocator& alloc) noexcept : heap_(alloc) {
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(size_t size, const Allocator& alloc) : heap_(alloc) {
+    Reserve(size);
+    std::uninitialized_value_construct_n(Data(), size);
+    now_ = size;
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(size_t size, const Type& value, const Allocator& alloc) : heap_(alloc) {
+    Reserve(size);
+    std::uninitialized_fill_n(Data(), size, value);
+    now_ = size;
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(std::initializer_list<Type> init, const Allocator& alloc) : heap_(alloc) {
+    Reserve(init.size());
+    std::uninitialized_copy(init.begin(), init.end(), Data());
+    now_ = init.size();
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(ReserveProxyObject obj, const Allocator& alloc) : heap_(alloc) {
+    Reserve(obj.reserve);
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(const SmallSimpleVector& other)
+    : heap_(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.GetAllocator())) {
+    Reserve(other.now_);
+    std::uninitialized_copy(other.begin(), other.end(), Data());
+    now_ = other.now_;
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::SmallSimpleVector(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>)
+    : heap_(other.GetAllocator()) {
+    StealFrom(other);
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>::~SmallSimpleVector() {
+    std::destroy(begin(), end());
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>& SmallSimpleVector<Type, N, Allocator>::operator=(const SmallSimpleVector& rhs) {
+    if (this == &rhs) return *this;
+    Clear();
+    Reserve(rhs.now_);
+    std::uninitialized_copy(rhs.begin(), rhs.end(), Data());
+    now_ = rhs.now_;
+    return *this;
+}
+
+template <typename Type, size_t N, typename Allocator>
+SmallSimpleVector<Type, N, Allocator>& SmallSimpleVector<Type, N, Allocator>::operator=(SmallSimpleVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+    if (this == &rhs) return *this;
+    Clear();
+    ArrayPtr<Type, Allocator> released(rhs.GetAllocator());
+    heap_.swap(released);
+    cap_ = N;
+    StealFrom(rhs);
+    return *this;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  ===>
+///                                               
+///
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::Clear() noexcept {
+    std::destroy(begin(), end());
+    now_ = 0;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::Resize(size_t new_size) {
+    if (new_size < now_) {
+        std::destroy(begin() + new_size, end());
+    }
+    else {
+        Reserve(new_size);
+        std::uninitialized_value_construct(end(), begin() + new_size);
+    }
+    now_ = new_size;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::swap(SmallSimpleVector& other) noexcept(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_swappable_v<Type>) {
+    if (this == &other) return;
+    if (!heap_ && !other.heap_) {
+        //   ,       
+        SmallSimpleVector& longer = now_ >= other.now_ ? *this : other;
+        SmallSimpleVector& shorter = now_ >= other.now_ ? other : *this;
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+        //now_     N, min     ( -Warray-bounds)
+        Relocate(longer.begin() + shorter.now_, longer.begin() + std::min(longer.now_, N), shorter.end());
+    }
+    else if (!heap_) {
+        //     :   
+        Relocate(begin(), end(), reinterpret_cast<Type*>(other.inline_));
+    }
+    else if (!other.heap_) {
+        Relocate(other.begin(), other.end(), reinterpret_cast<Type*>(inline_));
+    }
+    heap_.swap(other.heap_);
+    std::swap(now_, other.now_);
+    std::swap(cap_, other.cap_);
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::PushBack(const Type& item) {
+    EmplaceBack(item);
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::PushBack(Type&& item) {
+    EmplaceBack(std::move(item));
+}
+
+template <typename Type, size_t N, typename Allocator>
+Type* SmallSimpleVector<Type, N, Allocator>::Insert(ConstIterator pos, const Type& value) {
+    return Emplace(pos, value);
+}
+
+template <typename Type, size_t N, typename Allocator>
+Type* SmallSimpleVector<Type, N, Allocator>::Insert(ConstIterator pos, Type&& value) {
+    return Emplace(pos, std::move(value));
+}
+
+template <typename Type, size_t N, typename Allocator>
+template <typename... Args>
+Type& SmallSimpleVector<Type, N, Allocator>::EmplaceBack(Args&&... args) {
+    if (now_ >= cap_) {
+        RepeatPatternInsert(now_, std::forward<Args>(args)...);
+    }
+    else {
+        new (end()) Type(std::forward<Args>(args)...);
+    }
+    ++now_;
+    return *(end() - 1);
+}
+
+template <typename Type, size_t N, typename Allocator>
+template <typename... Args>
+Type* SmallSimpleVector<Type, N, Allocator>::Emplace(ConstIterator pos, Args&&... args) {
+    assert(pos >= begin() && pos <= end());
+    size_t elem_num = pos - cbegin();
+    if (now_ >= cap_) {
+        RepeatPatternInsert(elem_num, std::forward<Args>(args)...);
+    }
+    else if (elem_num == now_) {
+        new (end()) Type(std::forward<Args>(args)...);
+    }
+    else {
+        //      ,     
+        Type item(std::forward<Args>(args)...);
+        Iterator place = begin() + elem_num;
+        new (end()) Type(std::move(*(end() - 1)));
+        std::move_backward(place, end() - 1, end());
+        *place = std::move(item);
+    }
+    ++now_;
+    return begin() + elem_num;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::PopBack() noexcept {
+    if (now_ > 0) {
+        --now_;
+        std::destroy_at(end());
+    }
+}
+
+template <typename Type, size_t N, typename Allocator>
+Type* SmallSimpleVector<Type, N, Allocator>::Erase(ConstIterator pos) {
+    assert(pos >= begin() && pos < end());
+    Iterator place = begin() + (pos - cbegin());
+    std::move(place + 1, end(), place);
+    --now_;
+    std::destroy_at(end());
+    return place;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::Reserve(size_t new_capacity) {
+    if (new_capacity > cap_) {
+        Reallocate(new_capacity);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>  ===>
+///                                               
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::Reallocate(size_t new_cap) {
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (heap_) {
+            heap_.Reallocate(new_cap, now_);
+            cap_ = new_cap;
+            return;
+        }
+    }
+    ArrayPtr<Type, Allocator> ptr(new_cap, GetAllocator());
+    Relocate(begin(), end(), ptr.Get());
+    heap_.swap(ptr);
+    cap_ = new_cap;
+}
+
+template <typename Type, size_t N, typename Allocator>
+template <typename... Args>
+void SmallSimpleVector<Type, N, Allocator>::RepeatPatternInsert(size_t elem_num, Args&&... args) {
+    ArrayPtr<Type, Allocator> ptr(cap_ * 2, GetAllocator());
+    //   :      
+    new (ptr.Get() + elem_num) Type(std::forward<Args>(args)...);
+    Relocate(begin(), begin() + elem_num, ptr.Get());
+    Relocate(begin() + elem_num, end(), ptr.Get() + elem_num + 1);
+    heap_.swap(ptr);
+    cap_ *= 2;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::StealFrom(SmallSimpleVector& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+    if (other.heap_) {
+        heap_.swap(other.heap_);
+        cap_ = other.cap_;
+    }
+    else {
+        Relocate(other.begin(), other.end(), Data());
+    }
+    now_ = other.now_;
+    other.now_ = 0;
+    other.cap_ = N;
+}
+
+template <typename Type, size_t N, typename Allocator>
+void SmallSimpleVector<Type, N, Allocator>::Relocate(Iterator first, Iterator last, Iterator dest) {
+    if constexpr (IsTriviallyRelocatable<Type>::value) {
+        if (first != last) {
+            std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(Type));
+        }
+    }
+    else {
+        std::uninitialized_move(first, last, dest);
+        std::destroy(first, last);
+    }
+}
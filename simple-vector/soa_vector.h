@@ -0,0 +1,314 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "simple_vector.h"
+
+
+//    SoaVector.     
+template <typename Type>
+class ColumnSpan {
+public:
+    ColumnSpan(Type* data, size_t size) noexcept : data_(data), size_(size) {
+    }
+
+    Type* Data() const noexcept {
+        return data_;
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    Type* begin() const noexcept {
+        return data_;
+    }
+
+    Type* end() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    Type* data_;
+    size_t size_;
+};
+
+template <typename... Fields>
+class SoaVector;
+
+// ˸    SoaVector:     . Get<I>()    ,
+//   .      
+template <bool IsConst, typename... Fields>
+class SoaRow {
+    using Owner = std::conditional_t<IsConst, const SoaVector<Fields...>, SoaVector<Fields...>>;
+    friend class SoaVector<Fields...>;
+
+public:
+    template <size_t I>
+    using Reference = std::conditional_t<IsConst, const std::tuple_element_t<I, std::tuple<Fields...>>&,
+                                         std::tuple_element_t<I, std::tuple<Fields...>>&>;
+
+    //      
+    template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+    SoaRow(const SoaRow<OtherConst, Fields...>& other) noexcept : owner_(other.owner_), index_(other.index_) {
+    }
+
+    template <size_t I>
+    Reference<I> Get() const noexcept {
+        return std::get<I>(owner_->columns_)[index_];
+    }
+
+    size_t GetIndex() const noexcept {
+        return index_;
+    }
+
+    //     
+    std::tuple<Fields...> ToTuple() const {
+        return ToTuple(std::index_sequence_for<Fields...>());
+    }
+
+    template <bool Enabled = !IsConst, typename = std::enable_if_t<Enabled>>
+    const SoaRow& operator=(const std::tuple<Fields...>& values) const {
+        Assign(values, std::index_sequence_for<Fields...>());
+        return *this;
+    }
+
+private:
+    template <bool, typename...>
+    friend class SoaRow;
+
+    Owner* owner_;
+    size_t index_;
+
+    SoaRow(Owner* owner, size_t index) noexcept : owner_(owner), index_(index) {
+    }
+
+    template <size_t... I>
+    std::tuple<Fields...> ToTuple(std::index_sequence<I...>) const {
+        return std::tuple<Fields...>(Get<I>()...);
+    }
+
+    template <size_t... I>
+    void Assign(const std::tuple<Fields...>& values, std::index_sequence<I...>) const {
+        ((Get<I>() = std::get<I>(values)), ...);
+    }
+};
+
+//   : auto [x, y] = soa[i];
+template <size_t I, bool IsConst, typename... Fields>
+decltype(auto) get(const SoaRow<IsConst, Fields...>& row) noexcept {
+    return row.template Get<I>();
+}
+
+namespace std {
+
+template <bool IsConst, typename... Fields>
+struct tuple_size<SoaRow<IsConst, Fields...>> : std::integral_constant<size_t, sizeof...(Fields)> {
+};
+
+template <size_t I, bool IsConst, typename... Fields>
+struct tuple_element<I, SoaRow<IsConst, Fields...>> {
+    using type = typename SoaRow<IsConst, Fields...>::template Reference<I>;
+};
+
+} // namespace std
+
+//  ,       SimpleVector ( ).
+// ,      ,          .
+//       ,     SoaRow:
+//     SoaVector<float, float, int> particles;
+//     particles.PushBack(1.f, 2.f, 3);
+//     auto [x, y, id] = particles[0];   //    
+//     for (float& x : particles.Column<0>()) { ... }
+template <typename... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "SoaVector needs at least one field");
+
+    template <bool, typename...>
+    friend class SoaRow;
+
+public:
+    using Row = SoaRow<false, Fields...>;
+    using ConstRow = SoaRow<true, Fields...>;
+
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    size_t GetSize() const noexcept {
+        return std::get<0>(columns_).GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //    :      
+    size_t GetCapacity() const noexcept {
+        return std::apply([](const auto&... columns) { return std::min({columns.GetCapacity()...}); }, columns_);
+    }
+
+    Row operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return Row(this, index);
+    }
+
+    ConstRow operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return ConstRow(this, index);
+    }
+
+    //   std::out_of_range,  index >= size
+    Row At(size_t index) {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return Row(this, index);
+    }
+
+    ConstRow At(size_t index) const {
+        if (index >= GetSize()) throw std::out_of_range("out of range");
+        return ConstRow(this, index);
+    }
+
+    //   I   ,   
+    template <size_t I>
+    ColumnSpan<FieldType<I>> Column() noexcept {
+        auto& column = std::get<I>(columns_);
+        return ColumnSpan<FieldType<I>>(column.begin(), column.GetSize());
+    }
+
+    template <size_t I>
+    ColumnSpan<const FieldType<I>> Column() const noexcept {
+        const auto& column = std::get<I>(columns_);
+        return ColumnSpan<const FieldType<I>>(column.begin(), column.GetSize());
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// =======================================>>  ===>
+    ///
+    ///
+    /// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    //  ,   I  args[I].     ,
+    //        
+    template <typename... Args>
+    void EmplaceBack(Args&&... args);
+
+    void PushBack(const Fields&... values) {
+        EmplaceBack(values...);
+    }
+
+    void PushBack(Fields&&... values) {
+        EmplaceBack(std::move(values)...);
+    }
+
+    //   index,    
+    void Erase(size_t index);
+
+    //   index  O(1),     
+    void SwapErase(size_t index);
+
+    //   .     
+    void PopBack() noexcept;
+
+    void Clear() noexcept;
+
+    //   new_capacity    
+    void Reserve(size_t new_capacity);
+
+    void swap(SoaVector& other) noexcept {
+        columns_.swap(other.columns_);
+    }
+
+private:
+    std::tuple<SimpleVector<Fields>...> columns_;
+
+    template <typename Function>
+    void ForEachColumn(Function function) {
+        std::apply([&function](auto&... columns) { (function(columns), ...); }, columns_);
+    }
+
+    template <size_t I, typename ArgsTuple>
+    void EmplaceColumns(ArgsTuple& args);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename... Fields>
+template <typename... Args>
+void SoaVector<Fields...>::EmplaceBack(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields), "EmplaceBack takes one argument per field");
+    auto forwarded = std::forward_as_tuple(std::forward<Args>(args)...);
+    EmplaceColumns<0>(forwarded);
+}
+
+template <typename... Fields>
+template <size_t I, typename ArgsTuple>
+void SoaVector<Fields...>::EmplaceColumns(ArgsTuple& args) {
+    if constexpr (I < sizeof...(Fields)) {
+        //   ,       
+        std::get<I>(columns_).EmplaceBack(std::forward<std::tuple_element_t<I, ArgsTuple>>(std::get<I>(args)));
+        try {
+            EmplaceColumns<I + 1>(args);
+        } catch (...) {
+            std::get<I>(columns_).PopBack();
+            throw;
+        }
+    }
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Erase(size_t index) {
+    assert(index < GetSize());
+    ForEachColumn([index](auto& column) { column.Erase(column.cbegin() + index); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::SwapErase(size_t index) {
+    assert(index < GetSize());
+    ForEachColumn([index](auto& column) { column.SwapErase(column.cbegin() + index); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::PopBack() noexcept {
+    assert(!IsEmpty());
+    ForEachColumn([](auto& column) { column.PopBack(); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Clear() noexcept {
+    ForEachColumn([](auto& column) { column.Clear(); });
+}
+
+template <typename... Fields>
+void SoaVector<Fields...>::Reserve(size_t new_capacity) {
+    ForEachColumn([new_capacity](auto& column) { column.Reserve(new_capacity); });
+}
+
+template <typename... Fields>
+void swap(SoaVector<Fields...>& lhs, SoaVector<Fields...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
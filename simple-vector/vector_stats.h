@@ -0,0 +1,350 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include "array_ptr.h"
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+
+//    SimpleVector.
+//   : -DSIMPLE_VECTOR_STATS=1.        
+//     inline-.          
+#ifndef SIMPLE_VECTOR_STATS
+#define SIMPLE_VECTOR_STATS 0
+#endif
+
+struct VectorStats {
+    //    
+    uint64_t allocations = 0;
+    //    
+    uint64_t reallocations = 0;
+    //       
+    uint64_t elements_moved = 0;
+    uint64_t bytes_moved = 0;
+    //  
+    uint64_t peak_capacity = 0;
+    //  :   - ,   -    
+    uint64_t slack = 0;
+    //   
+    uint64_t instances = 0;
+};
+
+//   .         ,
+// SimpleVector::SetStatsTag    ,    .
+//    StatsRegistry        
+class StatsTag {
+public:
+    explicit StatsTag(std::string name);
+
+    //    make_name    GetName,      
+    explicit StatsTag(std::string (*make_name)()) noexcept;
+
+    StatsTag(const StatsTag&) = delete;
+    StatsTag& operator=(const StatsTag&) = delete;
+
+    const std::string& GetName() const;
+
+    VectorStats GetStats() const noexcept;
+
+    void RecordAllocation(size_t old_capacity, size_t new_capacity, size_t moved, size_t element_size) noexcept;
+
+    void RecordDestruction(size_t slack) noexcept;
+
+    void Reset() noexcept;
+
+private:
+    friend class StatsRegistry;
+
+    mutable std::string name_;
+    std::string (*make_name_)() = nullptr;
+    mutable std::once_flag name_built_;
+    std::atomic<uint64_t> allocations_{0};
+    std::atomic<uint64_t> reallocations_{0};
+    std::atomic<uint64_t> elements_moved_{0};
+    std::atomic<uint64_t> bytes_moved_{0};
+    std::atomic<uint64_t> peak_capacity_{0};
+    std::atomic<uint64_t> slack_{0};
+    std::atomic<uint64_t> instances_{0};
+    StatsTag* next_ = nullptr;
+
+    //     StatsRegistry
+    void Register() noexcept;
+};
+
+//   .       JSON
+class StatsRegistry {
+public:
+    //  function(const StatsTag&)   
+    template <typename Function>
+    static void ForEach(Function function) {
+        for (StatsTag* tag = Head().load(std::memory_order_acquire); tag != nullptr; tag = tag->next_) {
+            function(static_cast<const StatsTag&>(*tag));
+        }
+    }
+
+    //   JSON-,    
+    static void Dump(std::ostream& out);
+
+    //    
+    static void Reset() noexcept;
+
+private:
+    friend class StatsTag;
+
+    static std::atomic<StatsTag*>& Head() noexcept {
+        static std::atomic<StatsTag*> head{nullptr};
+        return head;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+///
+///
+/// =======================================>>
+///
+///
+/// ////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline StatsTag::StatsTag(std::string name) : name_(std::move(name)) {
+    Register();
+}
+
+inline StatsTag::StatsTag(std::string (*make_name)()) noexcept : make_name_(make_name) {
+    Register();
+}
+
+inline void StatsTag::Register() noexcept {
+    std::atomic<StatsTag*>& head = StatsRegistry::Head();
+    next_ = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+inline const std::string& StatsTag::GetName() const {
+    if (make_name_ != nullptr) {
+        std::call_once(name_built_, [this] {
+            name_ = make_name_();
+        });
+    }
+    return name_;
+}
+
+inline VectorStats StatsTag::GetStats() const noexcept {
+    VectorStats stats;
+    stats.allocations = allocations_.load(std::memory_order_relaxed);
+    stats.reallocations = reallocations_.load(std::memory_order_relaxed);
+    stats.elements_moved = elements_moved_.load(std::memory_order_relaxed);
+    stats.bytes_moved = bytes_moved_.load(std::memory_order_relaxed);
+    stats.peak_capacity = peak_capacity_.load(std::memory_order_relaxed);
+    stats.slack = slack_.load(std::memory_order_relaxed);
+    stats.instances = instances_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+inline void StatsTag::RecordAllocation(size_t old_capacity, size_t new_capacity, size_t moved, size_t element_size) noexcept {
+    (old_capacity == 0 ? allocations_ : reallocations_).fetch_add(1, std::memory_order_relaxed);
+    elements_moved_.fetch_add(moved, std::memory_order_relaxed);
+    bytes_moved_.fetch_add(moved * element_size, std::memory_order_relaxed);
+    uint64_t peak = peak_capacity_.load(std::memory_order_relaxed);
+    while (peak < new_capacity && !peak_capacity_.compare_exchange_weak(peak, new_capacity, std::memory_order_relaxed)) {
+    }
+}
+
+inline void StatsTag::RecordDestruction(size_t slack) noexcept {
+    slack_.fetch_add(slack, std::memory_order_relaxed);
+    instances_.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void StatsTag::Reset() noexcept {
+    for (std::atomic<uint64_t>* counter : {&allocations_, &reallocations_, &elements_moved_, &bytes_moved_,
+                                           &peak_capacity_, &slack_, &instances_}) {
+        counter->store(0, std::memory_order_relaxed);
+    }
+}
+
+namespace stats_detail {
+
+//    JSON,  ,      
+inline void WriteJsonString(std::ostream& out, const std::string& text) {
+    static const char kHex[] = "0123456789abcdef";
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\r':
+            out << "\\r";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u00" << kHex[c >> 4] << kHex[c & 0xf];
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+} // namespace stats_detail
+
+inline void StatsRegistry::Dump(std::ostream& out) {
+    out << "[";
+    bool first = true;
+    ForEach([&](const StatsTag& tag) {
+        VectorStats stats = tag.GetStats();
+        out << (first ? "\n" : ",\n") << "  {\"tag\": ";
+        stats_detail::WriteJsonString(out, tag.GetName());
+        out << ", \"allocations\": " << stats.allocations
+            << ", \"reallocations\": " << stats.reallocations
+            << ", \"elements_moved\": " << stats.elements_moved
+            << ", \"bytes_moved\": " << stats.bytes_moved
+            << ", \"peak_capacity\": " << stats.peak_capacity
+            << ", \"slack\": " << stats.slack
+            << ", \"instances\": " << stats.instances << "}";
+        first = false;
+    });
+    out << "\n]\n";
+}
+
+inline void StatsRegistry::Reset() noexcept {
+    for (StatsTag* tag = Head().load(std::memory_order_acquire); tag != nullptr; tag = tag->next_) {
+        tag->Reset();
+    }
+}
+
+namespace stats_detail {
+
+template <typename Type>
+std::string TypeName() {
+    const char* name = typeid(Type).name();
+#if defined(__GNUC__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+} // namespace stats_detail
+
+namespace stats_detail {
+
+template <typename Type>
+std::string DefaultTagName() {
+    return "SimpleVector<" + TypeName<Type>() + ">";
+}
+
+} // namespace stats_detail
+
+//        Type.   :     GetName
+template <typename Type>
+StatsTag& DefaultStatsTag() noexcept {
+    static StatsTag tag(&stats_detail::DefaultTagName<Type>);
+    return tag;
+}
+
+namespace stats_detail {
+
+//   SimpleVector,    
+template <typename Type, bool Enabled = SIMPLE_VECTOR_STATS>
+class Recorder {
+public:
+    void SetStatsTag(StatsTag&) noexcept {
+    }
+
+protected:
+    SIMPLE_VECTOR_CONSTEXPR void RecordAllocation(size_t, size_t, size_t) noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void RecordDestruction(size_t, size_t) noexcept {
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void SwapRecorded(Recorder&) noexcept {
+    }
+
+    VectorStats GetRecordedStats() const noexcept {
+        return {};
+    }
+};
+
+template <typename Type>
+class Recorder<Type, true> {
+public:
+    Recorder() = default;
+
+    //     :       
+    //    ,   .         
+    SIMPLE_VECTOR_CONSTEXPR Recorder(Recorder&& other) noexcept
+        : stats_(std::exchange(other.stats_, VectorStats{})), tag_(other.tag_) {
+    }
+
+    //       tag
+    void SetStatsTag(StatsTag& tag) noexcept {
+        tag_ = &tag;
+    }
+
+protected:
+    //  ( , ShrinkToFit  )   .
+    //,    ,  
+    SIMPLE_VECTOR_CONSTEXPR void RecordAllocation(size_t old_capacity, size_t new_capacity, size_t moved) noexcept {
+        if (new_capacity == 0 || IsConstantEvaluated()) {
+            return;
+        }
+        (old_capacity == 0 ? stats_.allocations : stats_.reallocations) += 1;
+        stats_.elements_moved += moved;
+        stats_.bytes_moved += moved * sizeof(Type);
+        stats_.peak_capacity = std::max<uint64_t>(stats_.peak_capacity, new_capacity);
+        GetTag().RecordAllocation(old_capacity, new_capacity, moved, sizeof(Type));
+    }
+
+    //,     ,    
+    SIMPLE_VECTOR_CONSTEXPR void RecordDestruction(size_t slack, size_t capacity) noexcept {
+        if (capacity > 0 && !IsConstantEvaluated()) {
+            GetTag().RecordDestruction(slack);
+        }
+    }
+
+    VectorStats GetRecordedStats() const noexcept {
+        return stats_;
+    }
+
+    SIMPLE_VECTOR_CONSTEXPR void SwapRecorded(Recorder& other) noexcept {
+        std::swap(stats_, other.stats_);
+        std::swap(tag_, other.tag_);
+    }
+
+private:
+    VectorStats stats_;
+    //nullptr -    .     ,    constexpr
+    StatsTag* tag_ = nullptr;
+
+    StatsTag& GetTag() noexcept {
+        return tag_ != nullptr ? *tag_ : DefaultStatsTag<Type>();
+    }
+};
+
+} // namespace stats_detail